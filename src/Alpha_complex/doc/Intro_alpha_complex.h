@@ -160,6 +160,12 @@ Table of Contents
  *
  * The simplex tree is pruned from the given maximum \f$ \alpha^2 \f$ value (cf.
  * `SimplicialComplexForAlpha::prune_above_filtration()`).
+ *
+ * As the filtration value of a simplex is at least its squared circumradius, which is at least the one of its faces,
+ * the simplices of the Delaunay triangulation with a greater squared circumradius are not even inserted in the simplex
+ * tree. A face that is not Gabriel in one of these cofaces is inserted with a \f$+\infty\f$ filtration value, that
+ * can only be lowered by its inserted cofaces. With `CGAL::Epick_d`, the simplices whose filtration value is within
+ * rounding errors of the maximum value may differ from the ones of the full complex pruned afterwards.
  * In the following example, the value is given by the user as argument of the program.
  *
  * \section weightedversion Weighted specific version
@@ -205,6 +211,30 @@ Table of Contents
  * \include alphaoffreader_for_doc_32.txt
  *
  *
+ * \section boundarymatrixexample Boundary matrix without simplicial complex
+ *
+ * When only the persistence is needed, `Alpha_complex::for_each_filtered_boundary` computes the same filtration values
+ * on flat arrays of faces built from the Delaunay triangulation, without any `Simplex_tree`, and streams the columns of
+ * the filtered boundary matrix in the order of the filtration. The faces and their vertices are freed dimension by
+ * dimension, so the peak memory is much lower than the one of `create_complex` followed by a persistence computation.
+ *
+ * This example inserts them in a `Gudhi::persistence_matrix::Matrix` and displays the barcode.
+ *
+ * \include Alpha_complex_boundary_matrix_persistence.cpp
+ *
+ * For many small point clouds, `Alpha_persistence_batch` reduces these boundary matrices itself, with buffers that are
+ * reused from one point cloud to the next, processes the point clouds in parallel with an inexact kernel, and stores
+ * all the persistence diagrams in contiguous arrays.
+ *
+ * \section periodicdversion Periodic version in any dimension
+ *
+ * CGAL periodic triangulations are only available in dimension 2 and 3 (cf. Alpha_complex_3d). In higher dimension,
+ * `Periodic_alpha_complex` computes the alpha complex of points in a periodic box up to a maximal
+ * \f$ \alpha^2 \f$ value, that must be lower than the square of a quarter of the smallest period. Instead of
+ * triangulating the \f$ 3^d \f$ copies of the points, only the images of the points that are closer to the box than
+ * \f$ 2 \alpha_{max} \f$ are added, which is enough for the simplices of filtration value up to
+ * \f$ \alpha^2_{max} \f$. The vertices of the complex are the indices of the input points.
+ *
  * \section weighted3dexample 3d specific version
  *
  * A specific module for Alpha complex is available in 3d (cf. Alpha_complex_3d) and allows to construct standard,
@@ -0,0 +1,54 @@
+#include <gudhi/Alpha_complex.h>
+// to reduce the boundary matrix streamed by the alpha complex, without any simplex tree
+#include <gudhi/matrix.h>
+#include <gudhi/persistence_matrix_options.h>
+
+#include <CGAL/Epick_d.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Barcode_options : Gudhi::persistence_matrix::Default_options<> {
+  static const bool has_column_pairings = true;
+};
+using Boundary_matrix = Gudhi::persistence_matrix::Matrix<Barcode_options>;
+
+void usage(int nbArgs, char * const progName) {
+  std::cerr << "Error: Number of arguments (" << nbArgs << ") is not correct\n";
+  std::cerr << "Usage: " << progName << " filename.off [alpha_square_max_value]\n";
+  std::cerr << "       i.e.: " << progName << " ../../data/points/tore3D_300.off 0.5\n";
+  exit(-1);  // ----- >>
+}
+
+int main(int argc, char **argv) {
+  if ((argc != 2) && (argc != 3)) usage(argc, (argv[0] - 1));
+
+  std::string off_file_name {argv[1]};
+  double alpha_square_max_value = std::numeric_limits<double>::infinity();
+  if (argc == 3) alpha_square_max_value = atof(argv[2]);
+
+  using Fast_kernel = CGAL::Epick_d<CGAL::Dynamic_dimension_tag>;
+  Gudhi::alpha_complex::Alpha_complex<Fast_kernel> alpha_complex_from_file(off_file_name);
+
+  // The columns are inserted in the order of the filtration, and the filtration values are kept to read the barcode
+  Boundary_matrix matrix;
+  std::vector<double> filtration_values;
+  alpha_complex_from_file.for_each_filtered_boundary(
+      [&](const std::vector<std::size_t>& boundary, int dimension, double filtration) {
+        matrix.insert_boundary(boundary, dimension);
+        filtration_values.push_back(filtration);
+      },
+      alpha_square_max_value);
+
+  std::clog << "Boundary matrix of " << filtration_values.size() << " simplices." << std::endl;
+  std::clog << "Persistence intervals of non-zero length, as [dimension] birth death:" << std::endl;
+  for (auto const& bar : matrix.get_current_barcode()) {
+    double birth = filtration_values[bar.birth];
+    // the death of an essential bar is the maximal value of the index type
+    bool essential = bar.death >= filtration_values.size();
+    double death = essential ? std::numeric_limits<double>::infinity() : filtration_values[bar.death];
+    if (death > birth) std::clog << "[" << bar.dim << "] " << birth << " " << death << std::endl;
+  }
+  return 0;
+}
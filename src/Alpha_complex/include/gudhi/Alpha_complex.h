@@ -17,6 +17,12 @@
 // to construct Alpha_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
 #include <cmath>  // isnan, fmax
 #include <memory>  // for std::unique_ptr
 #include <cstddef>  // for std::size_t
@@ -46,6 +52,10 @@
 #include <numeric>  // for std::iota
 #include <algorithm>  // for std::sort
 #include <type_traits>  // for std::is_same_v
+#include <iterator>  // for std::make_reverse_iterator
+#include <bitset>
+#include <functional>  // for std::greater
+#include <optional>
 
 // Make compilation fail - required for external projects - https://github.com/GUDHI/gudhi-devel/issues/10
 #if CGAL_VERSION_NR < 1041101000
@@ -98,6 +108,9 @@ template<typename D> struct Is_Epeck_D<CGAL::Epeck_d<D>> { static const bool val
  * [10^12,10^12+10^6]. Using `CGAL::Epick_d` makes the computations slightly faster, and the combinatorics are still
  * exact, but the computation of filtration values can exceptionally be arbitrarily bad. In all cases, we still
  * guarantee that the output is a valid filtration (faces have a filtration value no larger than their cofaces).
+ * - When GUDHI is built with TBB and the kernel is inexact (e.g. `CGAL::Epick_d`), the circumspheres and the filtration
+ * values of each dimension are computed in parallel by `create_complex`, with the same result as the sequential
+ * computation. The Delaunay triangulation itself is still built sequentially.
  */
 template<class Kernel = CGAL::Epeck_d<CGAL::Dynamic_dimension_tag>, bool Weighted = false>
 class Alpha_complex {
@@ -336,18 +349,82 @@ class Alpha_complex {
     return cache_[k];
   }
 
+  /// Return the circumcenter and circumradius of a range of vertices. The vertices are given in decreasing order, as
+  /// in Simplex_tree::simplex_vertex_range, for the same rounding.
+  template<class VertexIterator>
+  Sphere sphere(VertexIterator begin, VertexIterator end) {
+    // Using a transform_range is slower, currently.
+    thread_local std::vector<Point_d> v;
+    v.clear();
+    for (; begin != end; ++begin)
+      v.push_back(get_point_(*begin));
+    return kernel_.get_sphere(v.cbegin(), v.cend());
+  }
+
+  /// Return the circumradius of a range of vertices, given in decreasing order.
+  template<class VertexIterator>
+  FT radius(VertexIterator begin, VertexIterator end) {
+    thread_local std::vector<Point_d> v;
+    v.clear();
+    for (; begin != end; ++begin)
+      v.push_back(get_point_(*begin));
+    return kernel_.get_squared_radius(v.cbegin(), v.cend());
+  }
+
+  /// Sort the faces of width vertices stored in a flat array lexicographically, and remove the duplicates.
+  static void sort_unique_faces(std::vector<Internal_vertex_handle>& faces, int width) {
+    std::vector<std::size_t> order(faces.size() / width);
+    std::iota(order.begin(), order.end(), 0);
+    auto face = [&](std::size_t i) { return faces.begin() + i * width; };
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+      return std::lexicographical_compare(face(a), face(a) + width, face(b), face(b) + width);
+    });
+    order.erase(std::unique(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+      return std::equal(face(a), face(a) + width, face(b));
+    }), order.end());
+    std::vector<Internal_vertex_handle> sorted_faces;
+    sorted_faces.reserve(order.size() * width);
+    for (std::size_t i : order) sorted_faces.insert(sorted_faces.end(), face(i), face(i) + width);
+    faces.swap(sorted_faces);
+  }
+
+  /// Return the index of a face in a flat array of faces sorted by sort_unique_faces.
+  static std::size_t find_face(const std::vector<Internal_vertex_handle>& faces, int width,
+                               const std::vector<Internal_vertex_handle>& face) {
+    std::size_t first = 0, count = faces.size() / width;
+    while (count > 0) {
+      std::size_t step = count / 2, mid = first + step;
+      auto mid_face = faces.begin() + mid * width;
+      if (std::lexicographical_compare(mid_face, mid_face + width, face.begin(), face.end())) {
+        first = mid + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    GUDHI_CHECK(first < faces.size() / width, std::logic_error("Alpha_complex - facet not found in the triangulation"));
+    return first;
+  }
+
   /// Return the circumradius, either from the old cache or computed, without writing to the cache.
   template<class SimplicialComplexForAlpha>
   auto radius(SimplicialComplexForAlpha& cplx, typename SimplicialComplexForAlpha::Simplex_handle s) {
+    return radius(cplx, s, kernel_);
+  }
+
+  /// Same as above, with the given kernel, for instance the copy of kernel_ of a thread.
+  template<class SimplicialComplexForAlpha>
+  auto radius(SimplicialComplexForAlpha& cplx, typename SimplicialComplexForAlpha::Simplex_handle s,
+              const A_kernel_d& kernel) {
     auto k = cplx.key(s);
     if(k!=cplx.null_key())
-      return kernel_.get_squared_radius(old_cache_[k]);
+      return kernel.get_squared_radius(old_cache_[k]);
     // Using a transform_range is slower, currently.
     thread_local std::vector<Point_d> v;
     v.clear();
     for (auto vertex : cplx.simplex_vertex_range(s))
       v.push_back(get_point_(vertex));
-    return kernel_.get_squared_radius(v.cbegin(), v.cend());
+    return kernel.get_squared_radius(v.cbegin(), v.cend());
   }
 
  public:
@@ -358,9 +435,9 @@ class Alpha_complex {
    * \tparam SimplicialComplexForAlpha must meet `SimplicialComplexForAlpha` concept.
    * 
    * @param[in] complex SimplicialComplexForAlpha to be created.
-   * @param[in] max_alpha_square maximum for alpha square value. Default value is +\f$\infty\f$, and there is very
-   * little point using anything else since it does not save time. Useless if `default_filtration_value` is set to
-   * `true`.
+   * @param[in] max_alpha_square maximum for alpha square value. Default value is +\f$\infty\f$. When it is finite,
+   * the faces of the triangulation whose squared circumradius is greater are not inserted in the complex, which saves
+   * time and memory for small values. Useless if `default_filtration_value` is set to `true`.
    * @param[in] exact Exact filtration values computation. Not exact if `Kernel` is not <a target="_blank"
    * href="https://doc.cgal.org/latest/Kernel_d/structCGAL_1_1Epeck__d.html">CGAL::Epeck_d</a>.
    * @param[in] default_filtration_value Set this value to `true` if filtration values are not needed to be computed
@@ -403,6 +480,12 @@ class Alpha_complex {
       return false;  // ----- >>
     }
 
+    // Only the faces whose squared radius is below max_alpha_square can get a filtration value below it
+    const bool insert_below_threshold = !default_filtration_value &&
+                                        max_alpha_square < std::numeric_limits<Filtration_value>::infinity();
+    // Faces that are not Gabriel in a coface that is not inserted: their filtration value is above max_alpha_square
+    std::vector<Vector_vertex> non_gabriel_faces;
+
     // --------------------------------------------------------------------------------------------
     // Simplex_tree construction from loop on triangulation finite full cells list
     if (num_vertices() > 0) {
@@ -434,9 +517,16 @@ class Alpha_complex {
 #ifdef DEBUG_TRACES
         std::clog << std::endl;
 #endif  // DEBUG_TRACES
+        if (insert_below_threshold) {
+          insert_faces_below_threshold(complex, vertexVector, max_alpha_square, non_gabriel_faces);
+          continue;
+        }
         // Insert each simplex and its subfaces in the simplex tree - filtration is NaN
         complex.insert_simplex_and_subfaces(vertexVector, std::numeric_limits<Filtration_value>::quiet_NaN());
       }
+      for (auto const& face : non_gabriel_faces)
+        complex.assign_filtration(complex.find(face), std::numeric_limits<Filtration_value>::infinity());
+      non_gabriel_faces.clear();
     }
     // --------------------------------------------------------------------------------------------
 
@@ -445,6 +535,15 @@ class Alpha_complex {
       // --------------------------------------------------------------------------------------------
       // ### For i : d -> 0
       for (int decr_dim = triangulation_->maximal_dimension(); decr_dim >= 0; decr_dim--) {
+#ifdef GUDHI_USE_TBB
+        // The points of lazy exact kernels like Epeck_d share their exact representation, which is not thread safe.
+        if constexpr (std::is_floating_point_v<FT>) {
+          compute_filtration_values_in_parallel(complex, decr_dim);
+          old_cache_ = std::move(cache_);
+          cache_.clear();
+          continue;
+        }
+#endif
         // ### Foreach Sigma of dim i
         for (Simplex_handle f_simplex : complex.skeleton_simplex_range(decr_dim)) {
           int f_simplex_dim = complex.dimension(f_simplex);
@@ -487,7 +586,340 @@ class Alpha_complex {
     return true;
   }
 
+  /** \brief Computes the alpha filtration of the Delaunay triangulation without building a simplicial complex, and
+   * streams its boundary matrix.
+   *
+   * The faces of the triangulation are enumerated from its finite full cells and stored as flat arrays of vertices,
+   * one per dimension, with the indices of their facets. Their filtration values are computed as in
+   * `create_complex`, with the same results, but without any `Simplex_tree` nor any sphere cache larger than one
+   * dimension. The faces are then sorted by filtration value, then by dimension, and `visitor(boundary, dimension,
+   * filtration)` is called for each of them in this order, where `boundary` is the sorted range of the positions of
+   * its facets in this order. These are the columns of the filtered boundary matrix, that can be inserted as is in a
+   * `Gudhi::persistence_matrix::Matrix` with `insert_boundary`, and whose reduction gives the persistence barcode.
+   * The birth and death positions of the bars can be converted to filtration values by storing the values given to
+   * the visitor.
+   *
+   * \tparam Filtration_value Type of the filtration values. Must be capable to represent "Not-A-Number".
+   * \tparam BoundaryVisitor Callable as `visitor(const std::vector<std::size_t>& boundary, int dimension,
+   * Filtration_value filtration)`.
+   *
+   * @param[in] visitor Called once per face, in the order of the filtration.
+   * @param[in] max_alpha_square Faces with a greater filtration value are not streamed.
+   * @param[in] exact Exact filtration values computation, as in `create_complex`.
+   *
+   * @return true if the computation succeeds, false otherwise.
+   *
+   * @pre Delaunay triangulation must be already constructed with dimension strictly greater than 0.
+   */
+  template <typename Filtration_value = double, typename BoundaryVisitor>
+  bool for_each_filtered_boundary(BoundaryVisitor&& visitor,
+                                  Filtration_value max_alpha_square = std::numeric_limits<Filtration_value>::infinity(),
+                                  bool exact = false) {
+    static_assert(std::numeric_limits<Filtration_value>::has_quiet_NaN);
+    using std::isnan;
+
+    if (triangulation_ == nullptr) {
+      std::cerr << "Alpha_complex cannot for_each_filtered_boundary from a NULL triangulation\n";
+      return false;  // ----- >>
+    }
+    if (triangulation_->maximal_dimension() < 1) {
+      std::cerr << "Alpha_complex cannot for_each_filtered_boundary from a zero-dimension triangulation\n";
+      return false;  // ----- >>
+    }
+    if (num_vertices() == 0) return true;
+
+    // Vertices of the finite full cells, sorted, cell by cell
+    std::vector<Internal_vertex_handle> cells;
+    int top_dim = 0;
+    for (auto cit = triangulation_->finite_full_cells_begin(); cit != triangulation_->finite_full_cells_end(); ++cit) {
+      std::size_t first = cells.size();
+      for (auto vit = cit->vertices_begin(); vit != cit->vertices_end(); ++vit)
+        if (*vit != nullptr) cells.push_back((*vit)->data());
+      top_dim = static_cast<int>(cells.size() - first) - 1;
+      std::sort(cells.begin() + first, cells.end());
+    }
+    // faces[k] stores the vertices of the faces of dimension k, k+1 by k+1, sorted lexicographically
+    std::vector<std::vector<Internal_vertex_handle>> faces(std::max(top_dim, 0) + 1);
+    faces[0] = vertices_;
+    if (top_dim > 0) faces[top_dim] = std::move(cells);
+    top_dim = static_cast<int>(faces.size()) - 1;
+    sort_unique_faces(faces[top_dim], top_dim + 1);
+    // facets[k][i * (k + 1) + j] is the index in faces[k-1] of the facet of the i-th face of faces[k] without its j-th
+    // vertex
+    std::vector<std::vector<std::size_t>> facets(top_dim + 1);
+    std::vector<Internal_vertex_handle> facet(top_dim);
+    for (int dim = top_dim; dim > 0; --dim) {
+      if (dim > 1) {
+        for (std::size_t pos = 0; pos < faces[dim].size(); pos += dim + 1) {
+          for (int j = 0; j <= dim; ++j)
+            for (int l = 0; l <= dim; ++l)
+              if (l != j) faces[dim - 1].push_back(faces[dim][pos + l]);
+        }
+        sort_unique_faces(faces[dim - 1], dim);
+      }
+      facets[dim].reserve(faces[dim].size());
+      for (std::size_t pos = 0; pos < faces[dim].size(); pos += dim + 1) {
+        for (int j = 0; j <= dim; ++j) {
+          facet.clear();
+          for (int l = 0; l <= dim; ++l)
+            if (l != j) facet.push_back(faces[dim][pos + l]);
+          facets[dim].push_back(find_face(faces[dim - 1], dim, facet));
+        }
+      }
+    }
+
+    // ### For i : d -> 0, exactly as in create_complex
+    CGAL::NT_converter<FT, Filtration_value> cgal_converter;
+    std::vector<std::vector<Filtration_value>> filtrations(top_dim + 1);
+    for (int dim = 0; dim <= top_dim; ++dim)
+      filtrations[dim].resize(faces[dim].size() / (dim + 1), std::numeric_limits<Filtration_value>::quiet_NaN());
+    // keys[k][i] is the position in cache_ of the sphere of the i-th face of dimension k, if it was computed
+    std::vector<std::size_t> keys, old_keys;
+    const std::size_t null_key = std::numeric_limits<std::size_t>::max();
+    for (int dim = top_dim; dim >= 0; --dim) {
+      const std::vector<Internal_vertex_handle>& dim_faces = faces[dim];
+      if (dim > 0) keys.assign(faces[dim - 1].size() / dim, null_key);
+      for (std::size_t i = 0; i < filtrations[dim].size(); ++i) {
+        auto face_begin = dim_faces.begin() + i * (dim + 1);
+        Filtration_value& filtration = filtrations[dim][i];
+        if (isnan(filtration)) {
+          filtration = 0.0;
+          // No need to compute squared_radius on a non-weighted single point - alpha is 0.0
+          if (Weighted || dim > 0) {
+            auto const& sqrad = old_keys.empty() || old_keys[i] == null_key
+                                    ? radius(std::make_reverse_iterator(face_begin + dim + 1),
+                                             std::make_reverse_iterator(face_begin))
+                                    : kernel_.get_squared_radius(old_cache_[old_keys[i]]);
+#if CGAL_VERSION_NR >= 1050000000
+            if (exact) CGAL::exact(sqrad);
+#endif
+            filtration = cgal_converter(sqrad);
+          }
+        }
+        // No need to propagate further, unweighted points all have value 0
+        if (dim <= !Weighted) continue;
+        for (int j = 0; j <= dim; ++j) {
+          std::size_t f = facets[dim][i * (dim + 1) + j];
+          Filtration_value& facet_filtration = filtrations[dim - 1][f];
+          if (!isnan(facet_filtration)) {
+            facet_filtration = fmin(facet_filtration, filtration);
+          } else {
+            if (keys[f] == null_key) {
+              keys[f] = cache_.size();
+              auto facet_begin = faces[dim - 1].begin() + f * dim;
+              cache_.push_back(sphere(std::make_reverse_iterator(facet_begin + dim),
+                                      std::make_reverse_iterator(facet_begin)));
+            }
+            if (!kernel_.is_gabriel(cache_[keys[f]], get_point_(*(face_begin + j)))) facet_filtration = filtration;
+          }
+        }
+      }
+      old_cache_ = std::move(cache_);
+      cache_.clear();
+      old_keys = std::move(keys);
+      keys.clear();
+      // The vertices are not needed anymore
+      faces[dim] = std::vector<Internal_vertex_handle>();
+    }
+    old_cache_.clear();
+
+    if (!exact) {
+      // As in make_filtration_non_decreasing, a face must not appear after its cofaces
+      for (int dim = 1; dim <= top_dim; ++dim)
+        for (std::size_t i = 0; i < filtrations[dim].size(); ++i)
+          for (int j = 0; j <= dim; ++j)
+            filtrations[dim][i] = std::max(filtrations[dim][i], filtrations[dim - 1][facets[dim][i * (dim + 1) + j]]);
+    }
+
+    // Sort the faces (dimension, index) below max_alpha_square by filtration value, then by dimension
+    std::vector<std::pair<int, std::size_t>> order;
+    for (int dim = 0; dim <= top_dim; ++dim)
+      for (std::size_t i = 0; i < filtrations[dim].size(); ++i)
+        if (filtrations[dim][i] <= max_alpha_square) order.emplace_back(dim, i);
+    std::sort(order.begin(), order.end(), [&](auto const& a, auto const& b) {
+      Filtration_value fa = filtrations[a.first][a.second], fb = filtrations[b.first][b.second];
+      if (fa != fb) return fa < fb;
+      return a < b;
+    });
+
+    // positions[k][i] is the position in the filtration of the i-th face of dimension k
+    std::vector<std::vector<std::size_t>> positions(top_dim + 1);
+    for (int dim = 0; dim <= top_dim; ++dim) positions[dim].resize(filtrations[dim].size());
+    std::vector<std::size_t> boundary;
+    boundary.reserve(top_dim + 1);
+    for (std::size_t pos = 0; pos < order.size(); ++pos) {
+      auto [dim, i] = order[pos];
+      positions[dim][i] = pos;
+      boundary.clear();
+      if (dim > 0)
+        for (int j = 0; j <= dim; ++j) boundary.push_back(positions[dim - 1][facets[dim][i * (dim + 1) + j]]);
+      std::sort(boundary.begin(), boundary.end());
+      visitor(static_cast<const std::vector<std::size_t>&>(boundary), dim,
+              static_cast<Filtration_value>(filtrations[dim][i]));
+    }
+    return true;
+  }
+
  private:
+  /* Inserts the faces of a full cell whose squared radius is at most threshold, instead of the full cell and all its
+   * faces. The squared radius of a face is at most the one of its cofaces, so these faces are a subcomplex, and the
+   * other faces cannot have a filtration value below threshold. A face that is not Gabriel in one of the cofaces that
+   * are not inserted would get the filtration value of this coface, which is above threshold: it is added to
+   * non_gabriel_faces, for its filtration value to be set to +infinity before the propagation.
+   * The radii are computed with the vertices in decreasing order, as in radius() on a simplex handle, for the same
+   * rounding.
+   */
+  template <typename SimplicialComplexForAlpha, typename Filtration_value, typename Vector_vertex>
+  void insert_faces_below_threshold(SimplicialComplexForAlpha& complex, Vector_vertex cell, Filtration_value threshold,
+                                    std::vector<Vector_vertex>& non_gabriel_faces) {
+    const int num_cell_vertices = static_cast<int>(cell.size());
+    // The faces are subsets of vertices as bit masks, this is only reasonable in small dimension
+    if (num_cell_vertices > 16) {
+      complex.insert_simplex_and_subfaces(cell, std::numeric_limits<Filtration_value>::quiet_NaN());
+      return;
+    }
+    CGAL::NT_converter<FT, Filtration_value> cgal_converter;
+    std::sort(cell.begin(), cell.end(), std::greater<>());
+    const unsigned full_cell = (1u << num_cell_vertices) - 1;
+    auto num_vertices_of = [](unsigned mask) { return std::bitset<16>(mask).count(); };
+    Vector_vertex face;
+    auto vertices_of = [&](unsigned mask) -> const Vector_vertex& {
+      face.clear();
+      for (int i = 0; i < num_cell_vertices; ++i)
+        if (mask >> i & 1) face.push_back(cell[i]);
+      return face;
+    };
+
+    // The facets of a face are smaller masks, and are visited first
+    std::vector<bool> below_threshold(full_cell + 1, false);
+    for (unsigned mask = 1; mask <= full_cell; ++mask) {
+      // The vertices are all inserted anyway
+      if (num_vertices_of(mask) == 1) {
+        below_threshold[mask] = true;
+        continue;
+      }
+      bool facets_below_threshold = true;
+      for (int i = 0; i < num_cell_vertices && facets_below_threshold; ++i)
+        if (mask >> i & 1) facets_below_threshold = below_threshold[mask ^ (1u << i)];
+      if (!facets_below_threshold) continue;
+      auto const& vertices = vertices_of(mask);
+      below_threshold[mask] = cgal_converter(radius(vertices.begin(), vertices.end())) <= threshold;
+    }
+    if (below_threshold[full_cell]) {
+      complex.insert_simplex_and_subfaces(cell, std::numeric_limits<Filtration_value>::quiet_NaN());
+      return;
+    }
+
+    for (unsigned mask = 1; mask < full_cell; ++mask) {
+      if (!below_threshold[mask]) continue;
+      bool maximal = true;
+      // No propagation to the vertices if not weighted, as in create_complex
+      bool check_gabriel = num_vertices_of(mask) > !Weighted;
+      std::optional<Sphere> sphere_of_face;
+      for (int i = 0; i < num_cell_vertices; ++i) {
+        if (mask >> i & 1) continue;
+        if (below_threshold[mask | (1u << i)]) {
+          maximal = false;
+        } else if (check_gabriel) {
+          if (!sphere_of_face) {
+            auto const& vertices = vertices_of(mask);
+            sphere_of_face = sphere(vertices.begin(), vertices.end());
+          }
+          if (!kernel_.is_gabriel(*sphere_of_face, get_point_(cell[i]))) {
+            non_gabriel_faces.push_back(vertices_of(mask));
+            check_gabriel = false;
+          }
+        }
+      }
+      if (maximal && num_vertices_of(mask) > 1)
+        complex.insert_simplex_and_subfaces(vertices_of(mask), std::numeric_limits<Filtration_value>::quiet_NaN());
+    }
+  }
+
+#ifdef GUDHI_USE_TBB
+  /* Same as one iteration of the loop on the dimensions in create_complex, with the same result:
+   * 1. the alpha values of the simplices of dimension dim that are not filtered yet are computed in parallel,
+   * 2. the spheres of the faces of dimension dim-1 that are not filtered yet are all cached, in parallel,
+   * 3. the Gabriel tests of all these faces in their cofaces are run in parallel,
+   * 4. the values are propagated sequentially, in the same order as propagate_alpha_filtration.
+   * Each thread uses its own copy of kernel_, whose functors may keep some state.
+   */
+  template <typename SimplicialComplexForAlpha>
+  void compute_filtration_values_in_parallel(SimplicialComplexForAlpha& complex, int dim) {
+    using Filtration_value = typename SimplicialComplexForAlpha::Filtration_value;
+    using Simplex_handle = typename SimplicialComplexForAlpha::Simplex_handle;
+    using std::isnan;
+    CGAL::NT_converter<FT, Filtration_value> cgal_converter;
+    tbb::enumerable_thread_specific<A_kernel_d> kernels(kernel_);
+
+    std::vector<Simplex_handle> simplices;
+    for (Simplex_handle sh : complex.skeleton_simplex_range(dim))
+      if (complex.dimension(sh) == dim) simplices.push_back(sh);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, simplices.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        A_kernel_d& kernel = kernels.local();
+                        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                          Simplex_handle sh = simplices[i];
+                          if (!isnan(complex.filtration(sh))) continue;
+                          // No need to compute squared_radius on a non-weighted single point - alpha is 0.0
+                          Filtration_value alpha_complex_filtration = 0.0;
+                          if (Weighted || dim > 0) alpha_complex_filtration = cgal_converter(radius(complex, sh, kernel));
+                          complex.assign_filtration(sh, alpha_complex_filtration);
+                        }
+                      });
+    // No need to propagate further, unweighted points all have value 0
+    if (dim <= !Weighted) return;
+
+    std::vector<Simplex_handle> faces;
+    for (Simplex_handle sh : complex.skeleton_simplex_range(dim - 1)) {
+      if (complex.dimension(sh) == dim - 1 && isnan(complex.filtration(sh))) {
+        complex.assign_key(sh, faces.size());
+        faces.push_back(sh);
+      }
+    }
+    cache_.resize(faces.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, faces.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        A_kernel_d& kernel = kernels.local();
+                        thread_local std::vector<Point_d> v;
+                        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                          v.clear();
+                          for (auto vertex : complex.simplex_vertex_range(faces[i])) v.push_back(get_point_(vertex));
+                          cache_[i] = kernel.get_sphere(v.cbegin(), v.cend());
+                        }
+                      });
+
+    // is_gabriel[i * (dim + 1) + j] for the j-th face of the i-th simplex, if this face is not filtered yet
+    std::vector<char> is_gabriel(simplices.size() * (dim + 1));
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, simplices.size()),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        A_kernel_d& kernel = kernels.local();
+                        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                          std::size_t j = i * (dim + 1);
+                          for (auto face_opposite_vertex : complex.boundary_opposite_vertex_simplex_range(simplices[i])) {
+                            if (isnan(complex.filtration(face_opposite_vertex.first)))
+                              is_gabriel[j] = kernel.is_gabriel(cache_[complex.key(face_opposite_vertex.first)],
+                                                                get_point_(face_opposite_vertex.second));
+                            ++j;
+                          }
+                        }
+                      });
+
+    for (std::size_t i = 0; i < simplices.size(); ++i) {
+      std::size_t j = i * (dim + 1);
+      Filtration_value filtration = complex.filtration(simplices[i]);
+      for (auto face_opposite_vertex : complex.boundary_opposite_vertex_simplex_range(simplices[i])) {
+        auto f_boundary = face_opposite_vertex.first;
+        if (!isnan(complex.filtration(f_boundary)))
+          complex.assign_filtration(f_boundary, fmin(complex.filtration(f_boundary), filtration));
+        else if (!is_gabriel[j])
+          complex.assign_filtration(f_boundary, filtration);
+        ++j;
+      }
+    }
+  }
+#endif  // GUDHI_USE_TBB
+
   template <typename SimplicialComplexForAlpha, typename Simplex_handle>
   void propagate_alpha_filtration(SimplicialComplexForAlpha& complex, Simplex_handle f_simplex) {
     // From SimplicialComplexForAlpha type required to assign filtration values.
@@ -0,0 +1,232 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef ALPHA_PERSISTENCE_BATCH_H_
+#define ALPHA_PERSISTENCE_BATCH_H_
+
+#include <gudhi/Alpha_complex.h>
+
+#include <CGAL/Epick_d.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>  // for std::stable_sort, std::set_symmetric_difference
+#include <cstddef>  // for std::size_t
+#include <iterator>  // for std::begin, std::end, std::back_inserter
+#include <limits>  // for numeric_limits
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>  // for std::is_floating_point
+#include <vector>
+
+namespace Gudhi {
+
+namespace alpha_complex {
+
+/**
+ * \class Alpha_persistence_batch Alpha_persistence_batch.h gudhi/Alpha_persistence_batch.h
+ * \brief Computes the persistence diagrams of the alpha filtrations of many point clouds.
+ *
+ * \ingroup alpha_complex
+ *
+ * \details
+ * For small point clouds, building an `Alpha_complex`, a `Gudhi::Simplex_tree` and a
+ * `Gudhi::persistent_cohomology::Persistent_cohomology` for each of them costs more than the computations themselves.
+ * This class streams the filtered boundary matrix of each alpha complex with
+ * `Alpha_complex::for_each_filtered_boundary`, without any simplicial complex, and reduces it over
+ * \f$\mathbb{Z}/2\mathbb{Z}\f$ with the clearing optimization. The buffers of the boundary matrix and of the
+ * reduction are kept from one point cloud to the next, so that they are only allocated for the first ones.
+ *
+ * When <a target="_blank" href="https://www.threadingbuildingblocks.org/">Intel TBB</a> is available and the kernel
+ * is inexact (the filtration values are computed with `double`), the point clouds are processed in parallel, with one
+ * set of buffers per thread.
+ *
+ * The diagrams of all the point clouds are stored in contiguous arrays: the intervals of the \f$i\f$-th point cloud
+ * are the ones at positions `offsets()[i]` to `offsets()[i+1]` (excluded) of `dimensions()`, and their birth and death
+ * are at positions \f$2j\f$ and \f$2j+1\f$ of `intervals()`. The intervals of each point cloud are sorted by dimension,
+ * then by decreasing lifetime.
+ *
+ * \tparam Kernel as in `Alpha_complex`. Default is
+ * <a target="_blank" href="https://doc.cgal.org/latest/Kernel_d/structCGAL_1_1Epick__d.html">CGAL::Epick_d</a>
+ * < <a target="_blank" href="http://doc.cgal.org/latest/Kernel_23/classCGAL_1_1Dynamic__dimension__tag.html">
+ * CGAL::Dynamic_dimension_tag </a> >. The alpha complexes are not weighted.
+ */
+template <class Kernel = CGAL::Epick_d<CGAL::Dynamic_dimension_tag>>
+class Alpha_persistence_batch {
+ public:
+  /** \brief A point in Euclidean space.*/
+  using Point_d = typename Kernel::Point_d;
+
+  /** \brief Alpha_persistence_batch constructor.
+   *
+   * @param[in] max_alpha_square Maximal filtration value of the alpha complexes. The intervals that are not dead at
+   * this value have an infinite death.
+   * @param[in] min_persistence Only the intervals of length strictly greater than `min_persistence` are recorded.
+   * @param[in] exact Exact filtration values computation, as in `Alpha_complex::create_complex`.
+   * @exception std::invalid_argument If `min_persistence` is negative.
+   */
+  Alpha_persistence_batch(double max_alpha_square = std::numeric_limits<double>::infinity(),
+                          double min_persistence = 0., bool exact = false)
+      : max_alpha_square_(max_alpha_square), min_persistence_(min_persistence), exact_(exact) {
+    if (min_persistence < 0) throw std::invalid_argument("Alpha_persistence_batch - min_persistence must be >= 0");
+  }
+
+  /** \brief Computes the persistence diagrams of the alpha filtrations of the point clouds.
+   *
+   * The type PointCloudRange must be a random access range (`std::size` and `operator[]`), whose elements are ranges
+   * of `Kernel::Point_d`, as the `InputPointRange` of the `Alpha_complex` constructor. The diagrams of a previous
+   * computation are replaced.
+   *
+   * @exception std::invalid_argument If the points of a point cloud are of dimension 0.
+   */
+  template <typename PointCloudRange>
+  void compute(const PointCloudRange& point_clouds) {
+    const std::size_t num_clouds = std::size(point_clouds);
+    std::vector<std::vector<Persistence_interval>> diagrams(num_clouds);
+#ifdef GUDHI_USE_TBB
+    // The lazy exact number types are not thread safe
+    if constexpr (std::is_floating_point_v<typename Kernel::FT>) {
+      tbb::parallel_for(std::size_t(0), num_clouds, [&](std::size_t i) {
+        compute_diagram(point_clouds[i], thread_workspaces_.local(), diagrams[i]);
+      });
+    } else
+#endif
+    {
+      for (std::size_t i = 0; i < num_clouds; ++i) compute_diagram(point_clouds[i], workspace_, diagrams[i]);
+    }
+
+    offsets_.assign(1, 0);
+    dimensions_.clear();
+    intervals_.clear();
+    for (auto& diagram : diagrams) {
+      for (auto const& [dim, birth, death] : diagram) {
+        dimensions_.push_back(dim);
+        intervals_.push_back(birth);
+        intervals_.push_back(death);
+      }
+      offsets_.push_back(dimensions_.size());
+      diagram = std::vector<Persistence_interval>();
+    }
+  }
+
+  /** \brief Returns the number of point clouds of the last computation. */
+  std::size_t num_point_clouds() const { return offsets_.size() - 1; }
+
+  /** \brief Returns the positions of the first interval of each point cloud, followed by the total number of
+   * intervals. */
+  const std::vector<std::size_t>& offsets() const { return offsets_; }
+
+  /** \brief Returns the dimension of each interval. */
+  const std::vector<int>& dimensions() const { return dimensions_; }
+
+  /** \brief Returns the birth and the death of each interval, one after the other. */
+  const std::vector<double>& intervals() const { return intervals_; }
+
+ private:
+  using Persistence_interval = std::tuple<int, double, double>;
+  static constexpr std::size_t null_index = std::numeric_limits<std::size_t>::max();
+
+  // Buffers of one computation, kept for the next point clouds
+  struct Workspace {
+    // Filtered boundary matrix, as given by for_each_filtered_boundary, with the boundaries in a flat array
+    std::vector<int> dimensions;
+    std::vector<double> filtrations;
+    std::vector<std::size_t> boundary_offsets;
+    std::vector<std::size_t> boundaries;
+    // Reduced columns, only the first filtrations.size() ones are used
+    std::vector<std::vector<std::size_t>> columns;
+    // pivot_of[i] is the column whose lowest row is i, or null_index
+    std::vector<std::size_t> pivot_of;
+    std::vector<bool> is_death;
+    std::vector<std::size_t> sum;
+  };
+
+  template <typename PointRange>
+  void compute_diagram(const PointRange& points, Workspace& ws, std::vector<Persistence_interval>& diagram) const {
+    if (std::begin(points) == std::end(points)) return;
+    Alpha_complex<Kernel> alpha_complex(points);
+    ws.dimensions.clear();
+    ws.filtrations.clear();
+    ws.boundary_offsets.assign(1, 0);
+    ws.boundaries.clear();
+    int max_dim = 0;
+    bool valid = alpha_complex.for_each_filtered_boundary(
+        [&](const std::vector<std::size_t>& boundary, int dim, double filtration) {
+          ws.dimensions.push_back(dim);
+          ws.filtrations.push_back(filtration);
+          ws.boundaries.insert(ws.boundaries.end(), boundary.begin(), boundary.end());
+          ws.boundary_offsets.push_back(ws.boundaries.size());
+          max_dim = std::max(max_dim, dim);
+        },
+        max_alpha_square_, exact_);
+    if (!valid) throw std::invalid_argument("Alpha_persistence_batch - the points must be of dimension at least 1");
+
+    const std::size_t num_faces = ws.filtrations.size();
+    // The inner vectors keep their capacity
+    if (ws.columns.size() < num_faces) ws.columns.resize(num_faces);
+    ws.pivot_of.assign(num_faces, null_index);
+    ws.is_death.assign(num_faces, false);
+    // Clearing: the columns of the highest dimension are reduced first, and a face that is the pivot of a column does
+    // not create a class, so its own column is zero and does not need to be reduced
+    for (int dim = max_dim; dim > 0; --dim) {
+      for (std::size_t j = 0; j < num_faces; ++j) {
+        if (ws.dimensions[j] != dim || ws.pivot_of[j] != null_index) continue;
+        std::vector<std::size_t>& column = ws.columns[j];
+        column.assign(ws.boundaries.begin() + ws.boundary_offsets[j],
+                      ws.boundaries.begin() + ws.boundary_offsets[j + 1]);
+        while (!column.empty()) {
+          std::size_t pivot_column = ws.pivot_of[column.back()];
+          if (pivot_column == null_index) {
+            ws.pivot_of[column.back()] = j;
+            ws.is_death[j] = true;
+            break;
+          }
+          const std::vector<std::size_t>& other = ws.columns[pivot_column];
+          ws.sum.clear();
+          std::set_symmetric_difference(column.begin(), column.end(), other.begin(), other.end(),
+                                        std::back_inserter(ws.sum));
+          column.swap(ws.sum);
+        }
+      }
+    }
+
+    const double inf = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < num_faces; ++i) {
+      if (ws.is_death[i]) continue;
+      double death = ws.pivot_of[i] == null_index ? inf : ws.filtrations[ws.pivot_of[i]];
+      if (death == inf || death - ws.filtrations[i] > min_persistence_)
+        diagram.emplace_back(ws.dimensions[i], ws.filtrations[i], death);
+    }
+    std::stable_sort(diagram.begin(), diagram.end(), [](auto const& a, auto const& b) {
+      if (std::get<0>(a) != std::get<0>(b)) return std::get<0>(a) < std::get<0>(b);
+      return std::get<2>(a) - std::get<1>(a) > std::get<2>(b) - std::get<1>(b);
+    });
+  }
+
+  double max_alpha_square_;
+  double min_persistence_;
+  bool exact_;
+  Workspace workspace_;
+#ifdef GUDHI_USE_TBB
+  tbb::enumerable_thread_specific<Workspace> thread_workspaces_;
+#endif
+  std::vector<std::size_t> offsets_ = {0};
+  std::vector<int> dimensions_;
+  std::vector<double> intervals_;
+};
+
+}  // namespace alpha_complex
+
+}  // namespace Gudhi
+
+#endif  // ALPHA_PERSISTENCE_BATCH_H_
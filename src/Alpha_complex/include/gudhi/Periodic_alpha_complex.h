@@ -0,0 +1,188 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERIODIC_ALPHA_COMPLEX_H_
+#define PERIODIC_ALPHA_COMPLEX_H_
+
+#include <gudhi/Alpha_complex.h>
+#include <gudhi/Simplex_tree.h>
+
+#include <CGAL/Epeck_d.h>
+
+#include <algorithm>  // for std::min_element
+#include <cmath>  // for std::sqrt
+#include <cstddef>  // for std::size_t
+#include <iostream>
+#include <iterator>  // for std::begin, std::end
+#include <limits>  // for numeric_limits
+#include <memory>  // for std::unique_ptr
+#include <stdexcept>
+#include <vector>
+
+namespace Gudhi {
+
+namespace alpha_complex {
+
+/**
+ * \class Periodic_alpha_complex Periodic_alpha_complex.h gudhi/Periodic_alpha_complex.h
+ * \brief Alpha complex of points in a periodic box of any dimension, up to a maximal alpha square value.
+ *
+ * \ingroup alpha_complex
+ *
+ * \details
+ * The points live in the flat torus defined by an iso-oriented box \f$\prod_i [l_i, u_i)\f$, where the distance is the
+ * minimal distance between the images of the points by the periods \f$u_i - l_i\f$. CGAL only provides periodic
+ * triangulations in dimension 2 and 3 (cf. Alpha_complex_3d), so this class triangulates the points of the box
+ * together with the images of the ones that are close to its boundary, with an `Alpha_complex`.
+ *
+ * A simplex of filtration value at most \f$\alpha^2_{max}\f$ has an empty ball of radius at most \f$\alpha_{max}\f$
+ * through its vertices, so all its vertices are within \f$2\alpha_{max}\f$ of any of them. Only the images of the
+ * points within \f$2\alpha_{max}\f$ of the box are then needed, instead of the \f$3^d\f$ copies of all of them: in
+ * small dimension, or when \f$\alpha_{max}\f$ is small compared to the periods, this is a small fraction of the
+ * points. Each simplex of the periodic complex appears several times in the triangulation, translated by periods, and
+ * is inserted once, with the indices of the input points as vertices.
+ *
+ * \f$\alpha_{max}\f$ must be smaller than a quarter of the smallest period, for the complex to be a simplicial
+ * complex (two distinct simplices cannot have the same vertices).
+ *
+ * \tparam Kernel as in `Alpha_complex`. Default is
+ * <a target="_blank" href="https://doc.cgal.org/latest/Kernel_d/structCGAL_1_1Epeck__d.html">CGAL::Epeck_d</a>
+ * < <a target="_blank" href="http://doc.cgal.org/latest/Kernel_23/classCGAL_1_1Dynamic__dimension__tag.html">
+ * CGAL::Dynamic_dimension_tag </a> >.
+ */
+template <class Kernel = CGAL::Epeck_d<CGAL::Dynamic_dimension_tag>>
+class Periodic_alpha_complex {
+ public:
+  /** \brief A point in Euclidean space.*/
+  using Point_d = typename Kernel::Point_d;
+
+  /** \brief Periodic_alpha_complex constructor from a list of points and a periodic box.
+   *
+   * @param[in] points Range of points, in the box.
+   * @param[in] lower_corner Range of the lower coordinates \f$l_i\f$ of the box.
+   * @param[in] upper_corner Range of the upper coordinates \f$u_i\f$ of the box.
+   * @param[in] max_alpha_square Maximal filtration value of the complex.
+   *
+   * @exception std::invalid_argument If the corners do not have the dimension of the points, if a point is not in the
+   * box, or if \f$\alpha_{max}\f$ is not smaller than a quarter of the smallest period.
+   *
+   * The type InputPointRange must be a range for which std::begin and std::end return input iterators on a
+   * `Kernel::Point_d`.
+   */
+  template <typename InputPointRange, typename CornerRange>
+  Periodic_alpha_complex(const InputPointRange& points, const CornerRange& lower_corner,
+                         const CornerRange& upper_corner, double max_alpha_square)
+      : max_alpha_square_(max_alpha_square) {
+    std::vector<double> lower(std::begin(lower_corner), std::end(lower_corner));
+    std::vector<double> upper(std::begin(upper_corner), std::end(upper_corner));
+    const int dim = static_cast<int>(lower.size());
+    if (upper.size() != lower.size())
+      throw std::invalid_argument("Periodic_alpha_complex - the corners of the box must have the same dimension");
+    std::vector<double> periods(dim);
+    for (int i = 0; i < dim; ++i) periods[i] = upper[i] - lower[i];
+    if (dim == 0 || !(4 * std::sqrt(max_alpha_square) < *std::min_element(periods.begin(), periods.end())))
+      throw std::invalid_argument("Periodic_alpha_complex - max_alpha_square must be lower than (period / 4)^2");
+    // The periodic images closer than twice alpha_max to the box, with a margin for the rounding of the distances
+    const double margin = 2 * std::sqrt(max_alpha_square) * (1 + 1e-6);
+
+    Kernel kernel;
+    std::vector<Point_d> all_points;
+    std::vector<typename Kernel::FT> coordinates(dim);
+    for (auto const& point : points) {
+      if (kernel.point_dimension_d_object()(point) != dim)
+        throw std::invalid_argument("Periodic_alpha_complex - the points must have the dimension of the box");
+      for (int i = 0; i < dim; ++i) {
+        double x = CGAL::to_double(point[i]);
+        if (x < lower[i] || x >= upper[i])
+          throw std::invalid_argument("Periodic_alpha_complex - the points must be in the box");
+      }
+      all_points.push_back(point);
+    }
+    num_points_ = all_points.size();
+    image_of_.resize(num_points_);
+    for (std::size_t index = 0; index < num_points_; ++index) image_of_[index] = index;
+
+    // Images of each point by the translations of -1, 0 or 1 period in each direction, except the point itself
+    for (std::size_t index = 0; index < num_points_; ++index) {
+      const Point_d point = all_points[index];
+      std::vector<std::vector<int>> offsets(dim);
+      for (int i = 0; i < dim; ++i) {
+        double x = CGAL::to_double(point[i]);
+        offsets[i].push_back(0);
+        if (x - lower[i] <= margin) offsets[i].push_back(1);
+        if (upper[i] - x <= margin) offsets[i].push_back(-1);
+      }
+      // Odometer on the product of the offsets
+      std::vector<std::size_t> digit(dim, 0);
+      while (true) {
+        int i = 0;
+        while (i < dim && ++digit[i] == offsets[i].size()) digit[i++] = 0;
+        if (i == dim) break;
+        for (int j = 0; j < dim; ++j) coordinates[j] = point[j] + offsets[j][digit[j]] * periods[j];
+        all_points.emplace_back(coordinates.begin(), coordinates.end());
+        image_of_.push_back(index);
+      }
+    }
+    alpha_complex_ = std::make_unique<Alpha_complex<Kernel>>(all_points);
+  }
+
+  /** \brief Returns the number of periodic images of the points that are triangulated, including the points
+   * themselves. */
+  std::size_t num_triangulated_points() const { return image_of_.size(); }
+
+  /** \brief Inserts the periodic alpha complex in the simplicial complex, with the indices of the input points as
+   * vertices.
+   *
+   * \tparam SimplicialComplexForAlpha must meet `SimplicialComplexForAlpha` concept.
+   *
+   * @param[in] complex SimplicialComplexForAlpha to be created. Must be empty.
+   * @param[in] exact Exact filtration values computation, as in `Alpha_complex::create_complex`.
+   *
+   * @return true if creation succeeds, false otherwise.
+   */
+  template <typename SimplicialComplexForAlpha>
+  bool create_complex(SimplicialComplexForAlpha& complex, bool exact = false) {
+    using Vertex_handle = typename SimplicialComplexForAlpha::Vertex_handle;
+    if (complex.num_vertices() > 0) {
+      std::cerr << "Periodic_alpha_complex create_complex - complex is not empty\n";
+      return false;  // ----- >>
+    }
+    // All the vertices of the images are within 2 alpha_max from the others, so none of them is cut by the margin
+    Simplex_tree<> images;
+    if (!alpha_complex_->create_complex(images, max_alpha_square_, exact)) return false;
+    std::vector<Vertex_handle> simplex;
+    for (auto sh : images.complex_simplex_range()) {
+      // Only the translate of the simplex whose vertex of lowest input index is in the box is inserted
+      simplex.clear();
+      std::size_t lowest_vertex = std::numeric_limits<std::size_t>::max();
+      for (auto vertex : images.simplex_vertex_range(sh)) {
+        simplex.push_back(static_cast<Vertex_handle>(image_of_[vertex]));
+        if (simplex.size() == 1 || image_of_[vertex] < image_of_[lowest_vertex]) lowest_vertex = vertex;
+      }
+      if (lowest_vertex >= num_points_) continue;
+      // The faces which are not in this position are inserted from another translate, with their own (lower) value
+      complex.insert_simplex_and_subfaces(simplex, images.filtration(sh));
+    }
+    return true;
+  }
+
+ private:
+  double max_alpha_square_;
+  std::size_t num_points_;
+  // image_of_[i] is the index of the input point of which the i-th triangulated point is an image
+  std::vector<std::size_t> image_of_;
+  std::unique_ptr<Alpha_complex<Kernel>> alpha_complex_;
+};
+
+}  // namespace alpha_complex
+
+}  // namespace Gudhi
+
+#endif  // PERIODIC_ALPHA_COMPLEX_H_
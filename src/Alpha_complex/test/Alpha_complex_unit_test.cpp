@@ -15,6 +15,7 @@
 
 #include <CGAL/Epick_d.h>
 #include <CGAL/Epeck_d.h>
+#include <CGAL/Random.h>
 
 #include <stdexcept> // std::out_of_range
 #include <string>
@@ -24,6 +25,10 @@
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Unitary_tests_utils.h>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/global_control.h>
+#endif
+
 // Use static dimension_tag for the user not to be able to set dimension
 typedef CGAL::Epeck_d< CGAL::Dimension_tag<4> > Kernel_4;
 typedef Kernel_4::Point_d Point_4;
@@ -223,3 +228,120 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_complex_with_duplicated_points, TestedKernel
     } catch (...) {}
   BOOST_CHECK(found == simplex_tree.num_vertices());
 }
+
+BOOST_AUTO_TEST_CASE(Alpha_complex_inexact_and_exact_filtrations) {
+  // Under TBB, the filtration values of an inexact kernel are computed in parallel, and the ones of an exact kernel
+  // sequentially
+  std::clog << "========== Alpha_complex_inexact_and_exact_filtrations ==========" << std::endl;
+  using Inexact_kernel_3 = CGAL::Epick_d< CGAL::Dimension_tag<3> >;
+  using Exact_kernel_3 = CGAL::Epeck_d< CGAL::Dimension_tag<3> >;
+
+  std::vector<Inexact_kernel_3::Point_d> inexact_points;
+  std::vector<Exact_kernel_3::Point_d> exact_points;
+  CGAL::Random rd(42);
+  for (int i = 0; i < 300; ++i) {
+    double x = rd.get_double(), y = rd.get_double(), z = rd.get_double();
+    inexact_points.emplace_back(x, y, z);
+    exact_points.emplace_back(x, y, z);
+  }
+
+  Gudhi::alpha_complex::Alpha_complex<Inexact_kernel_3> inexact_alpha(inexact_points);
+  Gudhi::Simplex_tree<> inexact_stree;
+  BOOST_CHECK(inexact_alpha.create_complex(inexact_stree));
+
+  Gudhi::alpha_complex::Alpha_complex<Exact_kernel_3> exact_alpha(exact_points);
+  Gudhi::Simplex_tree<> exact_stree;
+  BOOST_CHECK(exact_alpha.create_complex(exact_stree));
+
+  BOOST_CHECK(inexact_stree.num_simplices() == exact_stree.num_simplices());
+  for (auto sh : exact_stree.complex_simplex_range()) {
+    std::vector<int> simplex;
+    for (auto vertex : exact_stree.simplex_vertex_range(sh)) simplex.push_back(vertex);
+    auto inexact_sh = inexact_stree.find(simplex);
+    BOOST_REQUIRE(inexact_sh != inexact_stree.null_simplex());
+    GUDHI_TEST_FLOAT_EQUALITY_CHECK(inexact_stree.filtration(inexact_sh), exact_stree.filtration(sh), 1e-10);
+  }
+}
+
+#ifdef GUDHI_USE_TBB
+BOOST_AUTO_TEST_CASE(Alpha_complex_parallel_and_sequential_filtrations) {
+  // The parallel computation of the filtration values of an inexact kernel gives exactly the same result with one
+  // thread and with all the threads, where each thread uses its own copy of the kernel
+  std::clog << "========== Alpha_complex_parallel_and_sequential_filtrations ==========" << std::endl;
+  using Kernel_3 = CGAL::Epick_d< CGAL::Dimension_tag<3> >;
+
+  std::vector<Kernel_3::Point_d> points;
+  CGAL::Random rd(7);
+  for (int i = 0; i < 200; ++i) points.emplace_back(rd.get_double(), rd.get_double(), rd.get_double());
+
+  Gudhi::alpha_complex::Alpha_complex<Kernel_3> parallel_alpha(points);
+  Gudhi::Simplex_tree<> parallel_stree;
+  BOOST_CHECK(parallel_alpha.create_complex(parallel_stree));
+
+  Gudhi::Simplex_tree<> sequential_stree;
+  {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, 1);
+    Gudhi::alpha_complex::Alpha_complex<Kernel_3> sequential_alpha(points);
+    BOOST_CHECK(sequential_alpha.create_complex(sequential_stree));
+  }
+
+  BOOST_CHECK(parallel_stree == sequential_stree);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(Alpha_complex_filtered_boundaries_without_simplex_tree) {
+  std::clog << "========== Alpha_complex_filtered_boundaries_without_simplex_tree ==========" << std::endl;
+  using Inexact_kernel_3 = CGAL::Epick_d< CGAL::Dimension_tag<3> >;
+  std::vector<Inexact_kernel_3::Point_d> points;
+  CGAL::Random rd(42);
+  for (int i = 0; i < 300; ++i) points.emplace_back(rd.get_double(), rd.get_double(), rd.get_double());
+  Gudhi::alpha_complex::Alpha_complex<Inexact_kernel_3> alpha_complex(points);
+
+  for (double max_alpha_square : {std::numeric_limits<double>::infinity(), 0.005}) {
+    Gudhi::Simplex_tree<> stree;
+    BOOST_CHECK(alpha_complex.create_complex(stree, max_alpha_square));
+    std::vector<std::pair<int, double>> stree_filtration;
+    for (auto sh : stree.filtration_simplex_range()) stree_filtration.emplace_back(stree.dimension(sh), stree.filtration(sh));
+
+    std::vector<std::pair<int, double>> streamed_filtration;
+    BOOST_CHECK(alpha_complex.for_each_filtered_boundary(
+        [&](const std::vector<std::size_t>& boundary, int dimension, double filtration) {
+          BOOST_CHECK(boundary.size() == (dimension == 0 ? 0 : static_cast<std::size_t>(dimension + 1)));
+          for (std::size_t face : boundary) {
+            // The faces are streamed before their cofaces
+            BOOST_REQUIRE(face < streamed_filtration.size());
+            BOOST_CHECK(streamed_filtration[face].first == dimension - 1);
+            BOOST_CHECK(streamed_filtration[face].second <= filtration);
+          }
+          streamed_filtration.emplace_back(dimension, filtration);
+        },
+        max_alpha_square));
+
+    // Same values, computed in the same order
+    std::sort(stree_filtration.begin(), stree_filtration.end());
+    std::sort(streamed_filtration.begin(), streamed_filtration.end());
+    BOOST_CHECK(stree_filtration == streamed_filtration);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Alpha_complex_inserted_below_max_alpha_square) {
+  std::clog << "========== Alpha_complex_inserted_below_max_alpha_square ==========" << std::endl;
+  using Exact_kernel_3 = CGAL::Epeck_d< CGAL::Dimension_tag<3> >;
+  std::vector<Exact_kernel_3::Point_d> points;
+  CGAL::Random rd(42);
+  for (int i = 0; i < 300; ++i) points.emplace_back(rd.get_double(), rd.get_double(), rd.get_double());
+  Gudhi::alpha_complex::Alpha_complex<Exact_kernel_3> alpha_complex(points);
+
+  Gudhi::Simplex_tree<> full_stree;
+  BOOST_CHECK(alpha_complex.create_complex(full_stree));
+  for (double max_alpha_square : {0., 0.001, 0.005, 0.01}) {
+    std::clog << "max_alpha_square = " << max_alpha_square << std::endl;
+    Gudhi::Simplex_tree<> pruned_stree(full_stree);
+    pruned_stree.prune_above_filtration(max_alpha_square);
+    // Only the simplices below max_alpha_square are inserted, with the same filtration values
+    Gudhi::Simplex_tree<> stree;
+    BOOST_CHECK(alpha_complex.create_complex(stree, max_alpha_square));
+    BOOST_CHECK(stree.num_simplices() == pruned_stree.num_simplices());
+    BOOST_CHECK(stree == pruned_stree);
+  }
+}
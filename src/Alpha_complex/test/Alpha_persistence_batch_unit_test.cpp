@@ -0,0 +1,106 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "alpha_persistence_batch"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <CGAL/Epick_d.h>
+#include <CGAL/Epeck_d.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>  // for std::sort
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <gudhi/Alpha_persistence_batch.h>
+#include <gudhi/Alpha_complex.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+
+using Inexact_kernel = CGAL::Epick_d< CGAL::Dynamic_dimension_tag >;
+using Exact_kernel = CGAL::Epeck_d< CGAL::Dynamic_dimension_tag >;
+using list_of_kernels = boost::mpl::list<Inexact_kernel, Exact_kernel>;
+
+using Interval = std::tuple<int, double, double>;
+
+template <typename Kernel>
+std::vector<Interval> diagram_with_simplex_tree(const std::vector<typename Kernel::Point_d>& points,
+                                                double max_alpha_square) {
+  Gudhi::alpha_complex::Alpha_complex<Kernel> alpha_complex(points);
+  Gudhi::Simplex_tree<> stree;
+  alpha_complex.create_complex(stree, max_alpha_square);
+  Gudhi::persistent_cohomology::Persistent_cohomology<Gudhi::Simplex_tree<>, Gudhi::persistent_cohomology::Field_Zp>
+      pcoh(stree);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology(0.);
+  std::vector<Interval> diagram;
+  for (auto const& [birth, death, dim] : pcoh.get_persistent_pairs())
+    diagram.emplace_back(stree.dimension(birth), stree.filtration(birth),
+                         death == stree.null_simplex() ? std::numeric_limits<double>::infinity()
+                                                       : stree.filtration(death));
+  std::sort(diagram.begin(), diagram.end());
+  return diagram;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Alpha_persistence_batch_same_as_simplex_tree, Kernel, list_of_kernels) {
+  std::vector<std::vector<typename Kernel::Point_d>> point_clouds(20);
+  CGAL::Random rd(42);
+  for (auto& points : point_clouds) {
+    for (int i = 0; i < 40; ++i) points.emplace_back(rd.get_double(), rd.get_double(), rd.get_double());
+  }
+  // An empty point cloud has an empty diagram
+  point_clouds.emplace_back();
+
+  for (double max_alpha_square : {std::numeric_limits<double>::infinity(), 0.01}) {
+    Gudhi::alpha_complex::Alpha_persistence_batch<Kernel> batch(max_alpha_square);
+    // Twice, for the buffers to be reused
+    for (int run = 0; run < 2; ++run) {
+      batch.compute(point_clouds);
+      BOOST_CHECK(batch.num_point_clouds() == point_clouds.size());
+      BOOST_CHECK(batch.offsets().back() == batch.dimensions().size());
+      BOOST_CHECK(batch.intervals().size() == 2 * batch.dimensions().size());
+      for (std::size_t i = 0; i < point_clouds.size(); ++i) {
+        std::vector<Interval> diagram;
+        for (std::size_t j = batch.offsets()[i]; j < batch.offsets()[i + 1]; ++j)
+          diagram.emplace_back(batch.dimensions()[j], batch.intervals()[2 * j], batch.intervals()[2 * j + 1]);
+        std::sort(diagram.begin(), diagram.end());
+        if (point_clouds[i].empty())
+          BOOST_CHECK(diagram.empty());
+        else
+          BOOST_CHECK(diagram == diagram_with_simplex_tree<Kernel>(point_clouds[i], max_alpha_square));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Alpha_persistence_batch_min_persistence) {
+  std::vector<std::vector<Inexact_kernel::Point_d>> point_clouds(1);
+  CGAL::Random rd(7);
+  for (int i = 0; i < 40; ++i) point_clouds[0].emplace_back(rd.get_double(), rd.get_double());
+
+  Gudhi::alpha_complex::Alpha_persistence_batch<> all_intervals;
+  all_intervals.compute(point_clouds);
+  Gudhi::alpha_complex::Alpha_persistence_batch<> long_intervals(std::numeric_limits<double>::infinity(), 0.001);
+  long_intervals.compute(point_clouds);
+
+  std::size_t num_long_intervals = 0;
+  for (std::size_t j = 0; j < all_intervals.dimensions().size(); ++j)
+    if (all_intervals.intervals()[2 * j + 1] - all_intervals.intervals()[2 * j] > 0.001) ++num_long_intervals;
+  BOOST_CHECK(long_intervals.dimensions().size() == num_long_intervals);
+  // Sorted by dimension, then by decreasing lifetime, with the essential class first
+  BOOST_CHECK(long_intervals.dimensions()[0] == 0);
+  BOOST_CHECK(long_intervals.intervals()[1] == std::numeric_limits<double>::infinity());
+
+  BOOST_CHECK_THROW(Gudhi::alpha_complex::Alpha_persistence_batch<>(1., -1.), std::invalid_argument);
+}
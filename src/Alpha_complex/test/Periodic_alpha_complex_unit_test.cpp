@@ -0,0 +1,96 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "periodic_alpha_complex"
+#include <boost/test/unit_test.hpp>
+
+#include <CGAL/Epeck_d.h>
+#include <CGAL/Random.h>
+
+#include <stdexcept>  // std::invalid_argument
+#include <vector>
+
+#include <gudhi/Periodic_alpha_complex.h>
+#include <gudhi/Alpha_complex.h>
+#include <gudhi/Simplex_tree.h>
+
+using Kernel_3 = CGAL::Epeck_d< CGAL::Dimension_tag<3> >;
+using Point_3 = Kernel_3::Point_d;
+
+BOOST_AUTO_TEST_CASE(Periodic_alpha_complex_versus_all_periodic_copies) {
+  std::clog << "========== Periodic_alpha_complex_versus_all_periodic_copies ==========" << std::endl;
+  const std::vector<double> lower_corner {0., -1., 0.};
+  const std::vector<double> upper_corner {1., 1., 2.};
+  const double max_alpha_square = 0.04;
+
+  std::vector<Point_3> points;
+  CGAL::Random rd(42);
+  for (int i = 0; i < 100; ++i)
+    points.emplace_back(rd.get_double(0., 1.), rd.get_double(-1., 1.), rd.get_double(0., 2.));
+
+  Gudhi::alpha_complex::Periodic_alpha_complex<Kernel_3> periodic_alpha(points, lower_corner, upper_corner,
+                                                                        max_alpha_square);
+  std::clog << "Triangulated points: " << periodic_alpha.num_triangulated_points() << std::endl;
+  BOOST_CHECK(periodic_alpha.num_triangulated_points() < 27 * points.size());
+  Gudhi::Simplex_tree<> stree;
+  BOOST_CHECK(periodic_alpha.create_complex(stree, true));
+
+  // Same complex from the 27 copies of the points, keeping the simplices whose vertex of lowest index is in the box
+  std::vector<Point_3> copies;
+  std::vector<int> copy_of;
+  for (int x = -1; x <= 1; ++x)
+    for (int y = -1; y <= 1; ++y)
+      for (int z = -1; z <= 1; ++z)
+        for (std::size_t i = 0; i < points.size(); ++i) {
+          copies.emplace_back(points[i][0] + x, points[i][1] + 2 * y, points[i][2] + 2 * z);
+          // The copy in the box is the first one of each point with a negative index
+          copy_of.push_back((x == 0 && y == 0 && z == 0) ? -1 - static_cast<int>(i) : static_cast<int>(i));
+        }
+  Gudhi::alpha_complex::Alpha_complex<Kernel_3> copies_alpha(copies);
+  Gudhi::Simplex_tree<> copies_stree;
+  BOOST_CHECK(copies_alpha.create_complex(copies_stree, max_alpha_square, true));
+  Gudhi::Simplex_tree<> expected_stree;
+  for (auto sh : copies_stree.complex_simplex_range()) {
+    std::vector<int> simplex;
+    int lowest = -1;
+    bool lowest_in_box = false;
+    for (auto vertex : copies_stree.simplex_vertex_range(sh)) {
+      int index = copy_of[vertex] < 0 ? -1 - copy_of[vertex] : copy_of[vertex];
+      if (lowest < 0 || index < lowest) {
+        lowest = index;
+        lowest_in_box = copy_of[vertex] < 0;
+      }
+      simplex.push_back(index);
+    }
+    if (lowest_in_box) expected_stree.insert_simplex_and_subfaces(simplex, copies_stree.filtration(sh));
+  }
+  BOOST_CHECK(stree.num_simplices() == expected_stree.num_simplices());
+  BOOST_CHECK(stree == expected_stree);
+}
+
+BOOST_AUTO_TEST_CASE(Periodic_alpha_complex_exceptions) {
+  std::clog << "========== Periodic_alpha_complex_exceptions ==========" << std::endl;
+  std::vector<Point_3> points {Point_3(0.1, 0.2, 0.3), Point_3(0.5, 0.5, 0.5)};
+  const std::vector<double> lower_corner {0., 0., 0.};
+  const std::vector<double> upper_corner {1., 1., 1.};
+  // alpha_max must be lower than a quarter of the period
+  BOOST_CHECK_THROW(Gudhi::alpha_complex::Periodic_alpha_complex<Kernel_3>(points, lower_corner, upper_corner, 0.1),
+                    std::invalid_argument);
+  // Point out of the box
+  points.emplace_back(1., 0.5, 0.5);
+  BOOST_CHECK_THROW(Gudhi::alpha_complex::Periodic_alpha_complex<Kernel_3>(points, lower_corner, upper_corner, 0.01),
+                    std::invalid_argument);
+  // Dimension of the box
+  points.pop_back();
+  BOOST_CHECK_THROW(Gudhi::alpha_complex::Periodic_alpha_complex<Kernel_3>(points, std::vector<double>{0., 0.},
+                                                                           std::vector<double>{1., 1.}, 0.01),
+                    std::invalid_argument);
+}
@@ -9,6 +9,8 @@
  */
 
 #include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Cubical_morse_persistence.h>
+#include <gudhi/Persistent_cohomology.h>
 #include <gudhi/Clock.h>
 
 #include <vector>
@@ -68,5 +70,33 @@ int main() {
   Bitmap_cubical_complex complex_from_vertices2_5d(sizes_5d_vertices, data_5d_vertices, false);
   std::clog << cub_5d_from_vertices2_creation_clock << std::endl;
 
+  // A smooth 3D volume with some noise, where most cells are paired by the discrete gradient
+  std::vector<unsigned> sizes_3d(3, 64);
+  std::vector<double> data_3d;
+  for (unsigned z = 0; z < sizes_3d[2]; ++z)
+    for (unsigned y = 0; y < sizes_3d[1]; ++y)
+      for (unsigned x = 0; x < sizes_3d[0]; ++x)
+        data_3d.push_back(std::sin(x / 5.) * std::cos(y / 7.) + std::sin(z / 4.) + 0.05 * get_random());
+  Bitmap_cubical_complex complex_3d(sizes_3d, data_3d, true);
+
+  Gudhi::Clock pcoh_3d_clock("Persistent_cohomology of 262 144 top cells in 3D");
+  pcoh_3d_clock.begin();
+  Gudhi::persistent_cohomology::Persistent_cohomology<Bitmap_cubical_complex, Gudhi::persistent_cohomology::Field_Zp>
+      pcoh(complex_3d, true);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  std::clog << pcoh_3d_clock << std::endl;
+
+  Gudhi::Clock morse_3d_clock("Cubical_morse_persistence of 262 144 top cells in 3D");
+  morse_3d_clock.begin();
+  Gudhi::cubical_complex::Cubical_morse_persistence<Bitmap_cubical_complex> morse(complex_3d);
+  morse.compute_persistence();
+  std::clog << morse_3d_clock << std::endl;
+  std::clog << morse.num_critical_cells() << " critical cells out of " << complex_3d.num_simplices() << std::endl;
+
+  if (morse.persistence_pairs().size() != pcoh.get_persistent_pairs().size()) {
+    std::cerr << "Different numbers of intervals\n";
+    return 1;
+  }
   return 0;
 }
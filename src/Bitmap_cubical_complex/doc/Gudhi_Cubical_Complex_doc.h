@@ -98,6 +98,13 @@ namespace cubical_complex {
  * from the file Bitmap_cubical_complex_periodic_boundary_conditions_base.h to construct cubical complex with periodic
  * boundary conditions. One can also use Perseus style input files (see \ref FileFormatsPerseus).
  *
+ * \section CubicalMorsePersistence Persistence on the Morse complex
+ * The persistent homology of a cubical complex can be computed with
+ * `Gudhi::persistent_cohomology::Persistent_cohomology`, which handles all the cells of the bitmap. On images, most
+ * of these cells form pairs of persistence 0 that only depend on their neighbors. `Cubical_morse_persistence` first
+ * pairs them with a discrete gradient, computed in parallel, and only reduces the remaining critical cells. On smooth
+ * 3D volumes, this is an order of magnitude faster.
+ *
  * \section BitmapExamples Examples
  * End user programs are available in example/Bitmap_cubical_complex and utilities/Bitmap_cubical_complex folders.
  * 
@@ -15,6 +15,11 @@
 #include <gudhi/Bitmap_cubical_complex_base.h>
 #include <gudhi/Bitmap_cubical_complex_periodic_boundary_conditions_base.h>
 
+#include <boost/container/small_vector.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
 #endif
@@ -25,6 +30,7 @@
 #include <vector>
 #include <numeric>  // for iota
 #include <cstddef>
+#include <cstdint>  // for std::uint32_t
 #include <stdexcept>
 
 namespace Gudhi {
@@ -55,6 +61,56 @@ class Bitmap_cubical_complex : public T {
   typedef typename T::filtration_type Filtration_value;
   typedef Simplex_key Simplex_handle;
 
+ protected:
+  // Vector of cell positions or keys, stored on 32 bits when the number of cells allows it. The largest value of the
+  // 32 bits type stands for null_key().
+  class Cell_index_vector {
+   public:
+    void assign(std::size_t size, std::size_t num_cells) {
+      large_ = num_cells >= std::numeric_limits<std::uint32_t>::max();
+      if (large_) {
+        small_ = std::vector<std::uint32_t>();
+        large_values_.assign(size, 0);
+      } else {
+        large_values_ = std::vector<std::size_t>();
+        small_.assign(size, 0);
+      }
+    }
+    std::size_t size() const { return large_ ? large_values_.size() : small_.size(); }
+    bool empty() const { return size() == 0; }
+    std::size_t operator[](std::size_t i) const {
+      if (large_) return large_values_[i];
+      std::uint32_t value = small_[i];
+      return value == std::numeric_limits<std::uint32_t>::max() ? std::numeric_limits<std::size_t>::max() : value;
+    }
+    void set(std::size_t i, std::size_t value) {
+      if (large_)
+        large_values_[i] = value;
+      else
+        small_[i] = static_cast<std::uint32_t>(value);
+    }
+    // Calls f on the underlying std::vector
+    template <class F>
+    void visit(F&& f) {
+      if (large_)
+        f(large_values_);
+      else
+        f(small_);
+    }
+
+   private:
+    bool large_ = false;
+    std::vector<std::uint32_t> small_;
+    std::vector<std::size_t> large_values_;
+  };
+
+  struct Cell_index_at {
+    const Cell_index_vector* cells;
+    std::size_t operator()(std::size_t i) const { return (*cells)[i]; }
+  };
+
+ public:
+
   //*********************************************//
   // Constructors
   //*********************************************//
@@ -68,7 +124,8 @@ class Bitmap_cubical_complex : public T {
    * @param[in] perseus_style_file The name of a \ref FileFormatsPerseus "Perseus-style file".
    **/
   explicit Bitmap_cubical_complex(const char* perseus_style_file)
-      : T(perseus_style_file), key_associated_to_simplex(num_simplices()) {
+      : T(perseus_style_file) {
+    key_associated_to_simplex.assign(num_simplices(), num_simplices());
 #ifdef DEBUG_TRACES
     std::clog << "Bitmap_cubical_complex( const char* perseus_style_file )\n";
 #endif
@@ -83,7 +140,8 @@ class Bitmap_cubical_complex : public T {
   Bitmap_cubical_complex(const std::vector<unsigned>& dimensions,
                          const std::vector<Filtration_value>& cells,
                          bool input_top_cells = true)
-      : T(dimensions, cells, input_top_cells), key_associated_to_simplex(num_simplices()) {
+      : T(dimensions, cells, input_top_cells) {
+    key_associated_to_simplex.assign(num_simplices(), num_simplices());
   }
 
   /**
@@ -97,8 +155,8 @@ class Bitmap_cubical_complex : public T {
                          const std::vector<Filtration_value>& cells,
                          const std::vector<bool>& directions_in_which_periodic_b_cond_are_to_be_imposed,
                          bool input_top_cells = true)
-      : T(dimensions, cells, directions_in_which_periodic_b_cond_are_to_be_imposed, input_top_cells),
-        key_associated_to_simplex(num_simplices()) {
+      : T(dimensions, cells, directions_in_which_periodic_b_cond_are_to_be_imposed, input_top_cells) {
+    key_associated_to_simplex.assign(num_simplices(), num_simplices());
   }
 
   /**
@@ -196,7 +254,7 @@ class Bitmap_cubical_complex : public T {
     std::clog << "void assign_key(Simplex_handle& sh, Simplex_key key)\n";
 #endif
     GUDHI_CHECK(sh != null_simplex(), std::invalid_argument("assign_key(null_simplex()) is not supported"));
-    this->key_associated_to_simplex[sh] = key;
+    this->key_associated_to_simplex.set(sh, key);
   }
 
   /**
@@ -210,10 +268,23 @@ class Bitmap_cubical_complex : public T {
   //*********************************************//
 
   /**
-   * Boundary_simplex_range class provides ranges for boundary iterators.
+   * Maximal dimension of the complexes whose boundaries are stored without memory allocation, in
+   * `Boundary_simplex_range`. Boundaries in higher dimension are still supported.
    **/
-  typedef typename std::vector<Simplex_handle>::iterator Boundary_simplex_iterator;
-  typedef typename std::vector<Simplex_handle> Boundary_simplex_range;
+  static constexpr unsigned max_inline_dimension() { return 4; }
+
+  /**
+   * Boundary_simplex_range class provides ranges for boundary iterators. It is a vector that stores its elements
+   * inside the object, up to dimension `max_inline_dimension()`.
+   **/
+  typedef boost::container::small_vector<Simplex_handle, 2 * max_inline_dimension()> Boundary_simplex_range;
+  typedef typename Boundary_simplex_range::iterator Boundary_simplex_iterator;
+
+  /**
+   * Iterator over the cells in filtration order.
+   **/
+  typedef boost::transform_iterator<Cell_index_at, boost::counting_iterator<std::size_t>, Simplex_handle,
+                                    Simplex_handle> Filtration_simplex_iterator;
 
   /**
    * Range of all the cells in filtration order.
@@ -221,7 +292,7 @@ class Bitmap_cubical_complex : public T {
    * (1) Dimension of a cube (lower dimensional comes first).
    * (2) Position in the data structure (the ones that are earliest in the data structure come first).
    **/
-  typedef std::vector<Simplex_handle> Filtration_simplex_range;
+  typedef boost::iterator_range<Filtration_simplex_iterator> Filtration_simplex_range;
 
   //*********************************************//
   // Methods to access iterators from the container:
@@ -230,7 +301,11 @@ class Bitmap_cubical_complex : public T {
    * boundary_simplex_range creates an object of a Boundary_simplex_range class
    * that provides ranges for the Boundary_simplex_iterator.
    **/
-  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) { return this->get_boundary_of_a_cell(sh); }
+  Boundary_simplex_range boundary_simplex_range(Simplex_handle sh) {
+    Boundary_simplex_range boundary;
+    this->for_each_boundary_element(sh, [&boundary](std::size_t b) { boundary.push_back(b); });
+    return boundary;
+  }
 
   /**
    * Range of all the cells in filtration order.
@@ -240,12 +315,15 @@ class Bitmap_cubical_complex : public T {
    *
    * This implicitly calls initialize_filtration() if it has never been called.
    **/
-  Filtration_simplex_range const& filtration_simplex_range() {
+  Filtration_simplex_range filtration_simplex_range() {
 #ifdef DEBUG_TRACES
     std::clog << "Filtration_simplex_range filtration_simplex_range()\n";
 #endif
     if (sorted_cells.empty()) initialize_filtration();
-    return sorted_cells;
+    Cell_index_at at{&sorted_cells};
+    return Filtration_simplex_range(
+        Filtration_simplex_iterator(boost::counting_iterator<std::size_t>(0), at),
+        Filtration_simplex_iterator(boost::counting_iterator<std::size_t>(sorted_cells.size()), at));
   }
   //*********************************************//
 
@@ -263,7 +341,7 @@ class Bitmap_cubical_complex : public T {
    * Returns the extremities of edge `e`
    **/
   std::pair<Simplex_handle, Simplex_handle> endpoints(Simplex_handle e) {
-    std::vector<std::size_t> bdry = this->get_boundary_of_a_cell(e);
+    Boundary_simplex_range bdry = boundary_simplex_range(e);
 #ifdef DEBUG_TRACES
     std::clog << "std::pair<Simplex_handle, Simplex_handle> endpoints( Simplex_handle e )\n";
     std::clog << "bdry.size() : " << bdry.size() << "\n";
@@ -393,8 +471,8 @@ class Bitmap_cubical_complex : public T {
   friend class is_before_in_filtration<T>;
 
  protected:
-  std::vector<std::size_t> key_associated_to_simplex;
-  std::vector<std::size_t> sorted_cells;
+  Cell_index_vector key_associated_to_simplex;
+  Cell_index_vector sorted_cells;
 };  // Bitmap_cubical_complex
 
 template <typename T>
@@ -402,14 +480,15 @@ void Bitmap_cubical_complex<T>::initialize_filtration() {
 #ifdef DEBUG_TRACES
   std::clog << "void Bitmap_cubical_complex<T>::initialize_elements_ordered_according_to_filtration() \n";
 #endif
-  this->sorted_cells.resize(this->data.size());
-  std::iota(std::begin(sorted_cells), std::end(sorted_cells), 0);
+  this->sorted_cells.assign(this->data.size(), this->data.size());
+  this->sorted_cells.visit([this](auto& cells) {
+    std::iota(std::begin(cells), std::end(cells), 0);
 #ifdef GUDHI_USE_TBB
-  tbb::parallel_sort(sorted_cells.begin(), sorted_cells.end(),
-                     is_before_in_filtration<T>(this));
+    tbb::parallel_sort(cells.begin(), cells.end(), is_before_in_filtration<T>(this));
 #else
-  std::sort(sorted_cells.begin(), sorted_cells.end(), is_before_in_filtration<T>(this));
+    std::sort(cells.begin(), cells.end(), is_before_in_filtration<T>(this));
 #endif
+  });
 }
 
 template <typename T>
@@ -115,6 +115,21 @@ class Bitmap_cubical_complex_base {
    **/
   virtual inline std::vector<std::size_t> get_coboundary_of_a_cell(std::size_t cell) const;
 
+  /**
+   * Calls `f` on the position of each boundary element of `cell`, in the same order as `get_boundary_of_a_cell`,
+   * without allocating memory. Unlike `get_boundary_of_a_cell`, this function is not virtual: the classes that change
+   * the boundary, like `Bitmap_cubical_complex_periodic_boundary_conditions_base`, hide it with their own version.
+   **/
+  template <class F>
+  void for_each_boundary_element(std::size_t cell, F&& f) const;
+
+  /**
+   * Calls `f` on the position of each coboundary element of `cell`, in the same order as `get_coboundary_of_a_cell`,
+   * without allocating memory. As `for_each_boundary_element`, this function is not virtual.
+   **/
+  template <class F>
+  void for_each_coboundary_element(std::size_t cell, F&& f) const;
+
   /**
    * This function finds a top-dimensional cell that is incident to the input cell and has
    * the same filtration value. In case several cells are suitable, an arbitrary one is
@@ -847,12 +862,8 @@ Bitmap_cubical_complex_base<T>::Bitmap_cubical_complex_base(const char* perseus_
 }
 
 template <typename T>
-std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_boundary_of_a_cell(std::size_t cell) const {
-  std::vector<std::size_t> boundary_elements;
-
-  // Speed traded of for memory. Check if it is better in practice.
-  boundary_elements.reserve(this->dimension() * 2);
-
+template <class F>
+void Bitmap_cubical_complex_base<T>::for_each_boundary_element(std::size_t cell, F&& f) const {
   std::size_t sum_of_dimensions = 0;
   std::size_t cell1 = cell;
   for (std::size_t i = this->multipliers.size(); i > 1; --i) {
@@ -860,11 +871,11 @@ std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_boundary_of_a_cell(
     cell1 = cell1 % this->multipliers[i - 1];
     if (position % 2 == 1) {
       if (sum_of_dimensions % 2) {
-        boundary_elements.push_back(cell + this->multipliers[i - 1]);
-        boundary_elements.push_back(cell - this->multipliers[i - 1]);
+        f(cell + this->multipliers[i - 1]);
+        f(cell - this->multipliers[i - 1]);
       } else {
-        boundary_elements.push_back(cell - this->multipliers[i - 1]);
-        boundary_elements.push_back(cell + this->multipliers[i - 1]);
+        f(cell - this->multipliers[i - 1]);
+        f(cell + this->multipliers[i - 1]);
       }
       ++sum_of_dimensions;
     }
@@ -872,44 +883,57 @@ std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_boundary_of_a_cell(
   // Split out the last iteration to save a costly division by multipliers[0]=1
   if (cell1 % 2 == 1) {
     if (sum_of_dimensions % 2) {
-      boundary_elements.push_back(cell + 1);
-      boundary_elements.push_back(cell - 1);
+      f(cell + 1);
+      f(cell - 1);
     } else {
-      boundary_elements.push_back(cell - 1);
-      boundary_elements.push_back(cell + 1);
+      f(cell - 1);
+      f(cell + 1);
     }
-    ++sum_of_dimensions;
   }
+}
 
+template <typename T>
+std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_boundary_of_a_cell(std::size_t cell) const {
+  std::vector<std::size_t> boundary_elements;
+
+  // Speed traded of for memory. Check if it is better in practice.
+  boundary_elements.reserve(this->dimension() * 2);
+  this->for_each_boundary_element(cell, [&](std::size_t b) { boundary_elements.push_back(b); });
   return boundary_elements;
 }
 
 template <typename T>
-std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_coboundary_of_a_cell(std::size_t cell) const {
-  std::vector<unsigned> counter = this->compute_counter_for_given_cell(cell);
-  std::vector<std::size_t> coboundary_elements;
+template <class F>
+void Bitmap_cubical_complex_base<T>::for_each_coboundary_element(std::size_t cell, F&& f) const {
   std::size_t cell1 = cell;
   for (std::size_t i = this->multipliers.size(); i > 1; --i) {
-    // It is a bit sad to recompute those divisions when we just did them in compute_counter_for_given_cell.
+    // position is the coordinate of the cell in this direction, as in compute_counter_for_given_cell.
     unsigned position = cell1 / this->multipliers[i - 1];
     cell1 = cell1 % this->multipliers[i - 1];
     if (position % 2 == 0) {
-      if ((cell > this->multipliers[i - 1]) && (counter[i - 1] != 0)) {
-        coboundary_elements.push_back(cell - this->multipliers[i - 1]);
+      if ((cell > this->multipliers[i - 1]) && (position != 0)) {
+        f(cell - this->multipliers[i - 1]);
       }
-      if ((cell + this->multipliers[i - 1] < this->data.size()) && (counter[i - 1] != 2 * this->sizes[i - 1])) {
-        coboundary_elements.push_back(cell + this->multipliers[i - 1]);
+      if ((cell + this->multipliers[i - 1] < this->data.size()) && (position != 2 * this->sizes[i - 1])) {
+        f(cell + this->multipliers[i - 1]);
       }
     }
   }
   if (cell1 % 2 == 0) {
-    if ((cell > 1) && (counter[0] != 0)) {
-      coboundary_elements.push_back(cell - 1);
+    if ((cell > 1) && (cell1 != 0)) {
+      f(cell - 1);
     }
-    if ((cell + 1 < this->data.size()) && (counter[0] != 2 * this->sizes[0])) {
-      coboundary_elements.push_back(cell + 1);
+    if ((cell + 1 < this->data.size()) && (cell1 != 2 * this->sizes[0])) {
+      f(cell + 1);
     }
   }
+}
+
+template <typename T>
+std::vector<std::size_t> Bitmap_cubical_complex_base<T>::get_coboundary_of_a_cell(std::size_t cell) const {
+  std::vector<std::size_t> coboundary_elements;
+  coboundary_elements.reserve(this->dimension() * 2);
+  this->for_each_coboundary_element(cell, [&](std::size_t c) { coboundary_elements.push_back(c); });
   return coboundary_elements;
 }
 
@@ -97,6 +97,20 @@ class Bitmap_cubical_complex_periodic_boundary_conditions_base : public Bitmap_c
    */
   virtual std::vector<std::size_t> get_coboundary_of_a_cell(std::size_t cell) const override;
 
+  /**
+   * A version of `Bitmap_cubical_complex_base::for_each_boundary_element` with periodic boundary conditions, that
+   * calls `f` on the boundary elements in the same order as `get_boundary_of_a_cell`.
+   */
+  template <class F>
+  void for_each_boundary_element(std::size_t cell, F&& f) const;
+
+  /**
+   * A version of `Bitmap_cubical_complex_base::for_each_coboundary_element` with periodic boundary conditions, that
+   * calls `f` on the coboundary elements in the same order as `get_coboundary_of_a_cell`.
+   */
+  template <class F>
+  void for_each_coboundary_element(std::size_t cell, F&& f) const;
+
   /**
   * This procedure compute incidence numbers between cubes. For a cube \f$A\f$ of
   * dimension n and a cube \f$B \subset A\f$ of dimension n-1, an incidence
@@ -428,14 +442,13 @@ Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::Bitmap_cubical_comp
 // ***********************Methods************************ //
 
 template <typename T>
-std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::get_boundary_of_a_cell(
-    std::size_t cell) const {
+template <class F>
+void Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::for_each_boundary_element(std::size_t cell,
+                                                                                            F&& f) const {
 #ifdef DEBUG_TRACES
   std::clog << "Computations of boundary of a cell : " << cell << std::endl;
 #endif
 
-  std::vector<std::size_t> boundary_elements;
-  boundary_elements.reserve(this->dimension() * 2);
   std::size_t cell1 = cell;
   std::size_t sum_of_dimensions = 0;
 
@@ -447,11 +460,11 @@ std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_bas
       // if there are no periodic boundary conditions in this direction, we do not have to do anything.
       if (!directions_in_which_periodic_b_cond_are_to_be_imposed[i - 1]) {
         if (sum_of_dimensions % 2) {
-          boundary_elements.push_back(cell - this->multipliers[i - 1]);
-          boundary_elements.push_back(cell + this->multipliers[i - 1]);
+          f(cell - this->multipliers[i - 1]);
+          f(cell + this->multipliers[i - 1]);
         } else {
-          boundary_elements.push_back(cell + this->multipliers[i - 1]);
-          boundary_elements.push_back(cell - this->multipliers[i - 1]);
+          f(cell + this->multipliers[i - 1]);
+          f(cell - this->multipliers[i - 1]);
         }
 #ifdef DEBUG_TRACES
         std::clog << cell - this->multipliers[i - 1] << " " << cell + this->multipliers[i - 1] << " ";
@@ -460,22 +473,22 @@ std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_bas
         // in this direction we have to do boundary conditions. Therefore, we need to check if we are not at the end.
         if (position != 2 * this->sizes[i - 1] - 1) {
           if (sum_of_dimensions % 2) {
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
-            boundary_elements.push_back(cell + this->multipliers[i - 1]);
+            f(cell - this->multipliers[i - 1]);
+            f(cell + this->multipliers[i - 1]);
           } else {
-            boundary_elements.push_back(cell + this->multipliers[i - 1]);
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
+            f(cell + this->multipliers[i - 1]);
+            f(cell - this->multipliers[i - 1]);
           }
 #ifdef DEBUG_TRACES
           std::clog << cell - this->multipliers[i - 1] << " " << cell + this->multipliers[i - 1] << " ";
 #endif
         } else {
           if (sum_of_dimensions % 2) {
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
-            boundary_elements.push_back(cell - (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
+            f(cell - this->multipliers[i - 1]);
+            f(cell - (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
           } else {
-            boundary_elements.push_back(cell - (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
-            boundary_elements.push_back(cell - this->multipliers[i - 1]);
+            f(cell - (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
+            f(cell - this->multipliers[i - 1]);
           }
 #ifdef DEBUG_TRACES
           std::clog << cell - this->multipliers[i - 1] << " "
@@ -486,41 +499,57 @@ std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_bas
       ++sum_of_dimensions;
     }
   }
-  return boundary_elements;
 }
 
 template <typename T>
-std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::get_coboundary_of_a_cell(
+std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::get_boundary_of_a_cell(
     std::size_t cell) const {
-  std::vector<unsigned> counter = this->compute_counter_for_given_cell(cell);
-  std::vector<std::size_t> coboundary_elements;
+  std::vector<std::size_t> boundary_elements;
+  boundary_elements.reserve(this->dimension() * 2);
+  this->for_each_boundary_element(cell, [&](std::size_t b) { boundary_elements.push_back(b); });
+  return boundary_elements;
+}
+
+template <typename T>
+template <class F>
+void Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::for_each_coboundary_element(std::size_t cell,
+                                                                                              F&& f) const {
   std::size_t cell1 = cell;
   for (std::size_t i = this->multipliers.size(); i != 0; --i) {
+    // position is the coordinate of the cell in this direction, as in compute_counter_for_given_cell.
     unsigned position = cell1 / this->multipliers[i - 1];
     cell1 = cell1 % this->multipliers[i - 1];
     // if the cell has zero length in this direction, then it will have cbd in this direction.
     if (position % 2 == 0) {
       if (!this->directions_in_which_periodic_b_cond_are_to_be_imposed[i - 1]) {
         // no periodic boundary conditions in this direction
-        if ((counter[i - 1] != 0) && (cell > this->multipliers[i - 1])) {
-          coboundary_elements.push_back(cell - this->multipliers[i - 1]);
+        if ((position != 0) && (cell > this->multipliers[i - 1])) {
+          f(cell - this->multipliers[i - 1]);
         }
-        if ((counter[i - 1] != 2 * this->sizes[i - 1]) && (cell + this->multipliers[i - 1] < this->data.size())) {
-          coboundary_elements.push_back(cell + this->multipliers[i - 1]);
+        if ((position != 2 * this->sizes[i - 1]) && (cell + this->multipliers[i - 1] < this->data.size())) {
+          f(cell + this->multipliers[i - 1]);
         }
       } else {
         // we want to have periodic boundary conditions in this direction
-        if (counter[i - 1] != 0) {
-          coboundary_elements.push_back(cell - this->multipliers[i - 1]);
-          coboundary_elements.push_back(cell + this->multipliers[i - 1]);
+        if (position != 0) {
+          f(cell - this->multipliers[i - 1]);
+          f(cell + this->multipliers[i - 1]);
         } else {
-          // in this case counter[i-1] == 0.
-          coboundary_elements.push_back(cell + this->multipliers[i - 1]);
-          coboundary_elements.push_back(cell + (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
+          // in this case position == 0.
+          f(cell + this->multipliers[i - 1]);
+          f(cell + (2 * this->sizes[i - 1] - 1) * this->multipliers[i - 1]);
         }
       }
     }
   }
+}
+
+template <typename T>
+std::vector<std::size_t> Bitmap_cubical_complex_periodic_boundary_conditions_base<T>::get_coboundary_of_a_cell(
+    std::size_t cell) const {
+  std::vector<std::size_t> coboundary_elements;
+  coboundary_elements.reserve(this->dimension() * 2);
+  this->for_each_coboundary_element(cell, [&](std::size_t c) { coboundary_elements.push_back(c); });
   return coboundary_elements;
 }
 
@@ -0,0 +1,257 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef CUBICAL_MORSE_PERSISTENCE_H_
+#define CUBICAL_MORSE_PERSISTENCE_H_
+
+#include <gudhi/Debug_utils.h>
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>  // for std::sort, std::push_heap, std::pop_heap
+#include <cstddef>  // for std::size_t
+#include <limits>  // for numeric_limits
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Gudhi {
+
+namespace cubical_complex {
+
+/**
+ * @brief Persistent homology of a cubical complex, computed on its Morse complex.
+ * @ingroup cubical_complex
+ * @details Computing the persistence of a `Bitmap_cubical_complex` with
+ * `Gudhi::persistent_cohomology::Persistent_cohomology` handles all the cells of the bitmap, while most of them form
+ * pairs of persistence 0 that are detected from their neighbors only. This class first computes the discrete gradient
+ * of the apparent pairs of the filtration: a cell \f$\sigma\f$ and its youngest facet \f$\tau\f$ form a pair if
+ * \f$\sigma\f$ is also the oldest cofacet of \f$\tau\f$. These pairs are persistence pairs, and each of them is
+ * decided from the neighbors of one cell, so the gradient is computed in parallel when
+ * <a target="_blank" href="https://www.threadingbuildingblocks.org/">Intel TBB</a> is available. Only the cells that
+ * are not paired, the critical cells of the gradient, are then reduced over \f$\mathbb{Z}/2\mathbb{Z}\f$, with the
+ * clearing optimization, the pairs of the gradient giving the reduced columns of the other cells.
+ *
+ * The filtration is the one of `Bitmap_cubical_complex`: the cells are ordered by filtration value, then by
+ * dimension, then by position in the bitmap. It can come from the top-dimensional cells or from the vertices.
+ *
+ * \tparam Bitmap `Bitmap_cubical_complex_base` or `Bitmap_cubical_complex_periodic_boundary_conditions_base` (or a
+ * class that derives from them, like `Bitmap_cubical_complex`).
+ */
+template <typename Bitmap>
+class Cubical_morse_persistence {
+ public:
+  typedef typename Bitmap::filtration_type Filtration_value;
+  /** \brief Dimension, birth cell and death cell of an interval. The death cell is `null_cell()` for the intervals of
+   * infinite persistence. */
+  typedef std::tuple<int, std::size_t, std::size_t> Persistence_pair;
+
+  /** \brief Position that is not a cell of the bitmap. */
+  static constexpr std::size_t null_cell() { return std::numeric_limits<std::size_t>::max(); }
+
+  /** \brief Cubical_morse_persistence constructor.
+   *
+   * @param[in] bitmap The cubical complex. It must not be modified or destroyed while this object is used.
+   */
+  explicit Cubical_morse_persistence(Bitmap& bitmap) : bitmap_(bitmap) {}
+
+  /** \brief Computes the persistence pairs.
+   *
+   * @param[in] min_persistence Only the intervals of length strictly greater than `min_persistence` are recorded.
+   * @exception std::invalid_argument If `min_persistence` is negative.
+   */
+  void compute_persistence(Filtration_value min_persistence = 0) {
+    if (min_persistence < 0)
+      throw std::invalid_argument("Cubical_morse_persistence - min_persistence must be >= 0");
+    min_persistence_ = min_persistence;
+    pairs_.clear();
+    compute_gradient();
+    collect_critical_cells();
+    std::unordered_set<std::size_t> killed;
+    for (int dim = static_cast<int>(critical_cells_.size()) - 1; dim > 0; --dim) reduce(dim, killed);
+    for (std::size_t vertex : critical_cells_[0])
+      if (killed.count(vertex) == 0) pairs_.emplace_back(0, vertex, null_cell());
+  }
+
+  /** \brief Returns the persistence pairs of the last computation. */
+  const std::vector<Persistence_pair>& persistence_pairs() const { return pairs_; }
+
+  /** \brief Returns the number of cells that are not paired by the discrete gradient, in the last computation. */
+  std::size_t num_critical_cells() const {
+    std::size_t num_cells = 0;
+    for (auto const& cells : critical_cells_) num_cells += cells.size();
+    return num_cells;
+  }
+
+ private:
+  enum : char { critical = 0, paired_with_cofacet = 1, paired_with_facet = 2 };
+
+  Filtration_value value(std::size_t cell) const { return bitmap_.get_cell_data(cell); }
+
+  // Order of the filtration between 2 cells of the same dimension
+  bool older(std::size_t a, std::size_t b) const {
+    Filtration_value fa = value(a), fb = value(b);
+    if (fa != fb) return fa < fb;
+    return a < b;
+  }
+
+  // Youngest facet of a cell, or null_cell() if it is a vertex or if this facet appears twice in the boundary (which
+  // happens with periodic boundary conditions on a bitmap of size 1)
+  std::size_t youngest_facet(std::size_t cell, int& dim) const {
+    std::size_t youngest = null_cell();
+    bool duplicate = false;
+    int num_facets = 0;
+    bitmap_.for_each_boundary_element(cell, [&](std::size_t facet) {
+      ++num_facets;
+      if (youngest == null_cell() || older(youngest, facet)) {
+        youngest = facet;
+        duplicate = false;
+      } else if (facet == youngest) {
+        duplicate = true;
+      }
+    });
+    dim = num_facets / 2;
+    return duplicate ? null_cell() : youngest;
+  }
+
+  std::size_t oldest_cofacet(std::size_t cell) const {
+    std::size_t oldest = null_cell();
+    bitmap_.for_each_coboundary_element(cell, [&](std::size_t cofacet) {
+      if (oldest == null_cell() || older(cofacet, oldest)) oldest = cofacet;
+    });
+    return oldest;
+  }
+
+  void record(int dim, std::size_t birth, std::size_t death) {
+    if (value(death) - value(birth) > min_persistence_) pairs_.emplace_back(dim, birth, death);
+  }
+
+  void compute_gradient() {
+    const std::size_t num_cells = bitmap_.size();
+    gradient_.assign(num_cells, critical);
+    // The apparent pairs form a matching, so the cells written by different iterations are different
+    auto process_cell = [this](std::size_t cell, std::vector<Persistence_pair>& pairs) {
+      int dim;
+      std::size_t facet = youngest_facet(cell, dim);
+      if (facet == null_cell() || oldest_cofacet(facet) != cell) return;
+      gradient_[cell] = paired_with_facet;
+      gradient_[facet] = paired_with_cofacet;
+      if (value(cell) - value(facet) > min_persistence_) pairs.emplace_back(dim - 1, facet, cell);
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::enumerable_thread_specific<std::vector<Persistence_pair>> thread_pairs;
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_cells), [&](const tbb::blocked_range<std::size_t>& r) {
+      std::vector<Persistence_pair>& pairs = thread_pairs.local();
+      for (std::size_t cell = r.begin(); cell != r.end(); ++cell) process_cell(cell, pairs);
+    });
+    for (auto const& pairs : thread_pairs) pairs_.insert(pairs_.end(), pairs.begin(), pairs.end());
+#else
+    for (std::size_t cell = 0; cell != num_cells; ++cell) process_cell(cell, pairs_);
+#endif
+  }
+
+  void collect_critical_cells() {
+    critical_cells_.assign(bitmap_.dimension() + 1, {});
+    for (std::size_t cell = 0; cell != gradient_.size(); ++cell)
+      if (gradient_[cell] == critical) critical_cells_[bitmap_.get_dimension_of_a_cell(cell)].push_back(cell);
+    for (auto& cells : critical_cells_) {
+      auto cmp = [this](std::size_t a, std::size_t b) { return older(a, b); };
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_sort(cells.begin(), cells.end(), cmp);
+#else
+      std::sort(cells.begin(), cells.end(), cmp);
+#endif
+    }
+  }
+
+  // Column as a heap of cells, the youngest on top, where a cell that appears twice cancels
+  void push_boundary(std::size_t cell) {
+    bitmap_.for_each_boundary_element(cell, [this](std::size_t facet) { push(facet); });
+  }
+  void push(std::size_t cell) {
+    column_.push_back(cell);
+    std::push_heap(column_.begin(), column_.end(), [this](std::size_t a, std::size_t b) { return older(a, b); });
+  }
+  std::size_t pop() {
+    std::pop_heap(column_.begin(), column_.end(), [this](std::size_t a, std::size_t b) { return older(a, b); });
+    std::size_t cell = column_.back();
+    column_.pop_back();
+    return cell;
+  }
+  std::size_t pop_pivot() {
+    while (!column_.empty()) {
+      std::size_t pivot = pop();
+      if (column_.empty() || column_.front() != pivot) return pivot;
+      pop();
+    }
+    return null_cell();
+  }
+
+  // Reduces the columns of the critical cells of dimension dim. killed contains the cells of dimension dim that are
+  // the pivot of a column of dimension dim+1 (clearing), and is replaced by the pivots of the columns of dimension dim.
+  void reduce(int dim, std::unordered_set<std::size_t>& killed) {
+    // Reduced column of each pivot, for the pivots that are not paired by the gradient
+    std::unordered_map<std::size_t, std::vector<std::size_t>> reduced_columns;
+    std::unordered_set<std::size_t> pivots;
+    for (std::size_t cell : critical_cells_[dim]) {
+      if (killed.count(cell)) continue;
+      column_.clear();
+      push_boundary(cell);
+      while (true) {
+        std::size_t pivot = pop_pivot();
+        if (pivot == null_cell()) {
+          // The column is 0, the cell creates a class that is never killed
+          pairs_.emplace_back(dim, cell, null_cell());
+          break;
+        }
+        push(pivot);
+        if (gradient_[pivot] == paired_with_cofacet) {
+          // The reduced column of the pivot is the boundary of its partner, which is before the current cell
+          push_boundary(oldest_cofacet(pivot));
+          continue;
+        }
+        auto it = reduced_columns.find(pivot);
+        if (it != reduced_columns.end()) {
+          for (std::size_t entry : it->second) push(entry);
+          continue;
+        }
+        std::vector<std::size_t> reduced;
+        for (std::size_t entry = pop_pivot(); entry != null_cell(); entry = pop_pivot()) reduced.push_back(entry);
+        reduced_columns.emplace(pivot, std::move(reduced));
+        pivots.insert(pivot);
+        record(dim - 1, pivot, cell);
+        break;
+      }
+    }
+    killed.swap(pivots);
+  }
+
+  Bitmap& bitmap_;
+  Filtration_value min_persistence_ = 0;
+  std::vector<char> gradient_;
+  std::vector<std::vector<std::size_t>> critical_cells_;
+  std::vector<std::size_t> column_;
+  std::vector<Persistence_pair> pairs_;
+};
+
+}  // namespace cubical_complex
+
+namespace Cubical_complex = cubical_complex;
+
+}  // namespace Gudhi
+
+#endif  // CUBICAL_MORSE_PERSISTENCE_H_
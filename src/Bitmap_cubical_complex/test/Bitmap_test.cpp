@@ -21,6 +21,8 @@
 #include <sstream>
 #include <vector>
 #include <limits>
+#include <numeric>  // for std::iota
+#include <algorithm>  // for std::equal
 
 typedef Gudhi::cubical_complex::Bitmap_cubical_complex_base<double> Bitmap_cubical_complex_base;
 typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_base> Bitmap_cubical_complex;
@@ -1285,3 +1287,33 @@ BOOST_AUTO_TEST_CASE(perseus_file_read) {
   std::clog << "Second value of sinusoid.txt is " << value << std::endl;
   BOOST_CHECK(value == std::numeric_limits<double>::infinity());
 }
+
+BOOST_AUTO_TEST_CASE(for_each_boundary_element_same_as_get_boundary) {
+  std::vector<unsigned> sizes({3, 2, 4});
+  std::vector<double> data(24);
+  std::iota(data.begin(), data.end(), 0.);
+  std::vector<bool> directions_of_periodicity({true, false, true});
+
+  Bitmap_cubical_complex cmplx(sizes, data);
+  Bitmap_cubical_complex_periodic_boundary_conditions periodic_cmplx(sizes, data, directions_of_periodicity);
+  auto check = [](auto& cpx) {
+    for (auto cell : cpx.all_cells_range()) {
+      std::vector<std::size_t> boundary, coboundary;
+      cpx.for_each_boundary_element(cell, [&](std::size_t b) { boundary.push_back(b); });
+      cpx.for_each_coboundary_element(cell, [&](std::size_t c) { coboundary.push_back(c); });
+      BOOST_CHECK(boundary == cpx.get_boundary_of_a_cell(cell));
+      BOOST_CHECK(coboundary == cpx.get_coboundary_of_a_cell(cell));
+      auto range = cpx.boundary_simplex_range(cell);
+      BOOST_CHECK(std::equal(range.begin(), range.end(), boundary.begin(), boundary.end()));
+    }
+  };
+  check(cmplx);
+  check(periodic_cmplx);
+
+  // The keys and the filtration order are stored on 32 bits, and null_key() must survive it
+  cmplx.assign_key(0, Bitmap_cubical_complex::null_key());
+  BOOST_CHECK(cmplx.key(0) == Bitmap_cubical_complex::null_key());
+  std::size_t position = 0;
+  for (auto cell : cmplx.filtration_simplex_range()) BOOST_CHECK(cmplx.simplex(position++) == cell);
+  BOOST_CHECK(position == cmplx.num_simplices());
+}
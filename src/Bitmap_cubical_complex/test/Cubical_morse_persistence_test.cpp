@@ -0,0 +1,107 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "cubical_morse_persistence"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Cubical_morse_persistence.h>
+#include <gudhi/Persistent_cohomology.h>
+
+#include <algorithm>  // for std::sort
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+typedef Gudhi::cubical_complex::Bitmap_cubical_complex_base<double> Bitmap_cubical_complex_base;
+typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_base> Bitmap_cubical_complex;
+typedef Gudhi::cubical_complex::Bitmap_cubical_complex_periodic_boundary_conditions_base<double>
+    Bitmap_cubical_complex_periodic_boundary_conditions_base;
+typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Bitmap_cubical_complex_periodic_boundary_conditions_base>
+    Bitmap_cubical_complex_periodic_boundary_conditions;
+
+using Interval = std::tuple<int, double, double>;
+
+template <typename Cubical>
+std::vector<Interval> diagram_with_persistent_cohomology(Cubical& cmplx, double min_persistence) {
+  // With the classes of the maximal dimension, that Cubical_morse_persistence always computes
+  Gudhi::persistent_cohomology::Persistent_cohomology<Cubical, Gudhi::persistent_cohomology::Field_Zp> pcoh(cmplx,
+                                                                                                         true);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology(min_persistence);
+  std::vector<Interval> diagram;
+  for (auto const& [birth, death, coeff] : pcoh.get_persistent_pairs())
+    diagram.emplace_back(cmplx.dimension(birth), cmplx.filtration(birth), cmplx.filtration(death));
+  std::sort(diagram.begin(), diagram.end());
+  return diagram;
+}
+
+template <typename Cubical>
+std::vector<Interval> diagram_with_morse_persistence(Cubical& cmplx, double min_persistence) {
+  Gudhi::cubical_complex::Cubical_morse_persistence<Cubical> morse(cmplx);
+  morse.compute_persistence(min_persistence);
+  BOOST_CHECK(morse.num_critical_cells() <= cmplx.num_simplices());
+  std::vector<Interval> diagram;
+  for (auto const& [dim, birth, death] : morse.persistence_pairs())
+    diagram.emplace_back(dim, cmplx.filtration(birth),
+                         death == morse.null_cell() ? std::numeric_limits<double>::infinity()
+                                                    : cmplx.filtration(death));
+  std::sort(diagram.begin(), diagram.end());
+  return diagram;
+}
+
+BOOST_AUTO_TEST_CASE(morse_persistence_same_as_persistent_cohomology) {
+  std::mt19937 gen(42);
+  // Few distinct values, for many pairs of persistence 0
+  std::uniform_int_distribution<int> dist(0, 5);
+  std::vector<std::vector<unsigned>> shapes{{17}, {7, 9}, {2, 6}, {5, 4, 6}, {3, 3, 3, 3}};
+  for (auto const& shape : shapes) {
+    for (bool input_top_cells : {true, false}) {
+      // The shape of the top-dimensional cells or of the vertices
+      std::size_t num_values = 1;
+      for (unsigned size : shape) num_values *= size;
+      std::vector<double> data(num_values);
+      for (auto& x : data) x = dist(gen);
+      for (double min_persistence : {0., 1.}) {
+        Bitmap_cubical_complex cmplx(shape, data, input_top_cells);
+        BOOST_CHECK(diagram_with_morse_persistence(cmplx, min_persistence) ==
+                    diagram_with_persistent_cohomology(cmplx, min_persistence));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(morse_persistence_with_periodic_boundary_conditions) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> dist(0., 1.);
+  std::vector<unsigned> shape{4, 5, 3};
+  std::vector<double> data(60);
+  for (auto& x : data) x = dist(gen);
+  for (auto periodicity : {std::vector<bool>{true, true, true}, std::vector<bool>{false, true, false}}) {
+    Bitmap_cubical_complex_periodic_boundary_conditions cmplx(shape, data, periodicity);
+    BOOST_CHECK(diagram_with_morse_persistence(cmplx, 0.) == diagram_with_persistent_cohomology(cmplx, 0.));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(morse_persistence_gradient) {
+  // A single minimum in a constant image: almost all the cells are paired by the gradient
+  std::vector<unsigned> shape{10, 10};
+  std::vector<double> data(100, 1.);
+  data[42] = 0.;
+  Bitmap_cubical_complex cmplx(shape, data);
+  Gudhi::cubical_complex::Cubical_morse_persistence<Bitmap_cubical_complex> morse(cmplx);
+  morse.compute_persistence();
+  BOOST_CHECK(morse.num_critical_cells() < cmplx.num_simplices() / 100);
+  BOOST_CHECK(morse.persistence_pairs().size() == 1);
+  BOOST_CHECK_THROW(morse.compute_persistence(-1.), std::invalid_argument);
+}
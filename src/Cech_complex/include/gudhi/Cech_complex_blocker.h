@@ -15,9 +15,12 @@
 #include <CGAL/Lazy_exact_nt.h> // for CGAL::exact
 
 #include <iostream>
+#include <optional>
 #include <vector>
 #include <set>
 #include <cmath>  // for std::sqrt
+#include <limits>  // for std::numeric_limits
+#include <utility>  // for std::move
 
 namespace Gudhi {
 
@@ -63,6 +66,23 @@ class Cech_blocker {
     return std::make_pair(std::move(c), std::move(r));
   }
 
+  // Sphere of a face, computed and cached the first time it is needed, and then found from the key of the face
+  Simplex_key get_face_sphere_key(Simplex_handle face) {
+    auto k = sc_ptr_->key(face);
+    if (k != sc_ptr_->null_key()) return k;
+    // Only the edges are not in the cache yet, the faces of higher dimension went through operator()
+    auto vertices = sc_ptr_->simplex_vertex_range(face);
+    auto vertex_it = vertices.begin();
+    auto const& p = cc_ptr_->get_point(*vertex_it);
+    auto const& q = cc_ptr_->get_point(*++vertex_it);
+    Point_d c = kernel_.midpoint_d_object()(p, q);
+    FT r = kernel_.squared_distance_d_object()(c, p);
+    Simplex_key sph_key = cc_ptr_->get_cache().size();
+    sc_ptr_->assign_key(face, sph_key);
+    cc_ptr_->get_cache().emplace_back(std::move(c), std::move(r));
+    return sph_key;
+  }
+
  public:
 
   /** \internal \brief Čech complex blocker operator() - the oracle - assigns the filtration value from the simplex
@@ -70,64 +90,64 @@ class Cech_blocker {
    *  \param[in] sh The Simplex_handle.
    *  \return true if the simplex radius is greater than the Cech_complex max_radius*/
   bool operator()(Simplex_handle sh) {
-    using Point_cloud =  std::vector<Point_d>;
+    CGAL::NT_converter<FT, Filtration_value> cast_to_fv;
     Filtration_value radius = 0;
     bool is_min_enclos_ball = false;
-    Point_cloud points;
     auto dim = sc_ptr_->dimension(sh);
     if (dim > kernel_.point_dimension_d_object()(cc_ptr_->get_point(0))) {
       // A sphere is always determined by at most d+1 points
       return false;
     }
-    points.reserve(dim + 1);
 
-    // for each face of simplex sh, test outsider point is indeed inside enclosing ball, if yes, take it and exit loop, otherwise, new sphere is circumsphere of all vertices
+    // for each face of simplex sh, test outsider point is indeed inside enclosing ball, if yes, take it and exit loop,
+    // otherwise, new sphere is circumsphere of all vertices
+    // If the MEB of a face, of center c and squared radius r2, does not contain the opposite vertex p, at squared
+    // distance D2 from c, any ball containing the simplex has a squared radius at least r2 + (D2 - r2)^2 / (4 D2),
+    // because c is in the convex hull of the points of the face on the boundary of their MEB.
+    std::optional<FT> squared_radius_lower_bound;
     for (auto face_opposite_vertex : sc_ptr_->boundary_opposite_vertex_simplex_range(sh)) {
-        auto k = sc_ptr_->key(face_opposite_vertex.first);
-        Simplex_key sph_key;
-        if(k != sc_ptr_->null_key()) {
-            sph_key = k;
-        }
-        else {
-            for (auto vertex : sc_ptr_->simplex_vertex_range(face_opposite_vertex.first)) {
-                points.push_back(cc_ptr_->get_point(vertex));
-#ifdef DEBUG_TRACES
-                std::clog << "#(" << vertex << ")#";
-#endif  // DEBUG_TRACES
-            }
-            // Put edge sphere in cache
-            sph_key = cc_ptr_->get_cache().size();
-            sc_ptr_->assign_key(face_opposite_vertex.first, sph_key);
-            cc_ptr_->get_cache().push_back(get_sphere(points.cbegin(), points.cend()));
-            // Clear face points
-            points.clear();
-        }
-        // Check if the minimal enclosing ball of current face contains the extra point/opposite vertex
-        Sphere const& sph = cc_ptr_->get_cache()[sph_key];
-        if (kernel_.squared_distance_d_object()(sph.first, cc_ptr_->get_point(face_opposite_vertex.second)) <= sph.second) {
-            is_min_enclos_ball = true;
-            sc_ptr_->assign_key(sh, sph_key);
-            radius = sc_ptr_->filtration(face_opposite_vertex.first);
+      Simplex_key sph_key = get_face_sphere_key(face_opposite_vertex.first);
+      // Check if the minimal enclosing ball of current face contains the extra point/opposite vertex
+      Sphere const& sph = cc_ptr_->get_cache()[sph_key];
+      FT squared_distance =
+          kernel_.squared_distance_d_object()(sph.first, cc_ptr_->get_point(face_opposite_vertex.second));
+      if (squared_distance <= sph.second) {
+        is_min_enclos_ball = true;
+        sc_ptr_->assign_key(sh, sph_key);
+        radius = sc_ptr_->filtration(face_opposite_vertex.first);
 #ifdef DEBUG_TRACES
-            std::clog << "center: " << sph.first << ", radius: " <<  radius << std::endl;
+        std::clog << "center: " << sph.first << ", radius: " << radius << std::endl;
 #endif  // DEBUG_TRACES
-            break;
-        }
+        break;
+      }
+      FT lower_bound = sph.second + CGAL::square(squared_distance - sph.second) / (4 * squared_distance);
+      if (!squared_radius_lower_bound || *squared_radius_lower_bound < lower_bound)
+        squared_radius_lower_bound = std::move(lower_bound);
     }
     // Spheres of each face don't contain the whole simplex
     if(!is_min_enclos_ball) {
-        for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) {
-            points.push_back(cc_ptr_->get_point(vertex));
-        }
-        Sphere sph = get_sphere(points.cbegin(), points.cend());
+      // Early exit: the simplex is blocked anyway, no need to compute its circumsphere
+      // Only with approximate radii, and with a margin for the rounding errors, as the bound may be tight
+      if (!cc_ptr_->is_exact() && squared_radius_lower_bound &&
+          std::sqrt(cast_to_fv(*squared_radius_lower_bound)) >
+              cc_ptr_->max_radius() * (1 + 16 * std::numeric_limits<Filtration_value>::epsilon())) {
+#ifdef DEBUG_TRACES
+        std::clog << "radius lower bound > max_radius => expansion is blocked\n";
+#endif  // DEBUG_TRACES
+        return true;
+      }
+      points_.clear();
+      for (auto vertex : sc_ptr_->simplex_vertex_range(sh)) {
+        points_.push_back(cc_ptr_->get_point(vertex));
+      }
+      Sphere sph = get_sphere(points_.cbegin(), points_.cend());
 #if CGAL_VERSION_NR >= 1050000000
-        if(cc_ptr_->is_exact()) CGAL::exact(sph.second);
+      if(cc_ptr_->is_exact()) CGAL::exact(sph.second);
 #endif
-        CGAL::NT_converter<FT, Filtration_value> cast_to_fv;
-        radius = std::sqrt(cast_to_fv(sph.second));
+      radius = std::sqrt(cast_to_fv(sph.second));
 
-        sc_ptr_->assign_key(sh, cc_ptr_->get_cache().size());
-        cc_ptr_->get_cache().push_back(std::move(sph));
+      sc_ptr_->assign_key(sh, cc_ptr_->get_cache().size());
+      cc_ptr_->get_cache().push_back(std::move(sph));
     }
 
 #ifdef DEBUG_TRACES
@@ -145,6 +165,8 @@ class Cech_blocker {
   SimplicialComplexForCech* sc_ptr_;
   Cech_complex* cc_ptr_;
   Kernel kernel_;
+  // Buffer for the vertices of the simplex, reused from one call to the next
+  std::vector<Point_d> points_;
 };
 
 }  // namespace cech_complex
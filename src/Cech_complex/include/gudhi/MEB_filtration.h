@@ -11,6 +11,18 @@
 #ifndef MEB_FILTRATION_H_
 #define MEB_FILTRATION_H_
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
+#include <cstddef>  // for std::size_t
+#include <optional>
+#include <type_traits>  // for std::decay_t, std::is_floating_point_v
+#include <utility>  // for std::pair, std::move
+#include <vector>
+
 namespace Gudhi::cech_complex {
 
 /**
@@ -30,20 +42,31 @@ namespace Gudhi::cech_complex {
  * @param[in] complex The simplicial complex.
  * @param[in] points Embedding of the vertices of the complex.
  * @param[in] exact If true and `Kernel` is <a href="https://doc.cgal.org/latest/Kernel_d/structCGAL_1_1Epeck__d.html">CGAL::Epeck_d</a>, the filtration values are computed exactly. Default is false.
+ *
+ * If Intel&reg; oneAPI TBB is available and the number type of `Kernel` is `double`, as with `CGAL::Epick_d`, the
+ * simplices are processed dimension by dimension, the ones of the same dimension in parallel with a copy of `k` per
+ * thread. The filtration values are the same as with the sequential computation.
  */
 
 template<typename Kernel, typename SimplicialComplexForMEB, typename PointRange>
 void assign_MEB_filtration(Kernel&&k, SimplicialComplexForMEB& complex, PointRange const& points, bool exact = false) {
-  using Point_d = typename Kernel::Point_d;
-  using FT = typename Kernel::FT;
+  using Point_d = typename std::decay_t<Kernel>::Point_d;
+  using FT = typename std::decay_t<Kernel>::FT;
   using Sphere = std::pair<Point_d, FT>;
 
   using Vertex_handle = typename SimplicialComplexForMEB::Vertex_handle;
   using Simplex_handle = typename SimplicialComplexForMEB::Simplex_handle;
+  using Simplex_key = typename SimplicialComplexForMEB::Simplex_key;
   using Filtration_value = typename SimplicialComplexForMEB::Filtration_value;
 
+  // What is known about the MEB of a simplex of positive dimension, before it is written in the complex
+  struct MEB {
+    Filtration_value filtration;
+    std::optional<Simplex_key> facet_key;  // key of the sphere of a facet, if it is also the MEB of the simplex
+    std::optional<Sphere> sphere;  // otherwise, the new sphere, if it has to be cached
+  };
+
   std::vector<Sphere> cache_;
-  std::vector<Point_d> pts;
   CGAL::NT_converter<FT, Filtration_value> cvt;
 
   // This block is only needed to get ambient_dim
@@ -53,10 +76,12 @@ void assign_MEB_filtration(Kernel&&k, SimplicialComplexForMEB& complex, PointRan
   }
   int ambient_dim = k.point_dimension_d_object()(*std::begin(points));
 
-  auto fun = [&](Simplex_handle sh, int dim){
+  // Only reads the complex and the cache, so that several simplices of the same dimension can be processed
+  // concurrently, each thread with its own kernel and point buffer.
+  auto compute_MEB = [&](auto& kernel, std::vector<Point_d>& pts, Simplex_handle sh, int dim) -> MEB {
     using std::max;
-    if (dim == 0) complex.assign_filtration(sh, 0);
-    else if (dim == 1) {
+    MEB meb{0, std::nullopt, std::nullopt};
+    if (dim == 1) {
       // For a Simplex_tree, this would be a bit faster, but that's probably negligible
       // Vertex_handle u = sh->first; Vertex_handle v = self_siblings(sh)->parent();
       auto verts = complex.simplex_vertex_range(sh);
@@ -64,56 +89,102 @@ void assign_MEB_filtration(Kernel&&k, SimplicialComplexForMEB& complex, PointRan
       Vertex_handle u = *vert_it;
       Vertex_handle v = *++vert_it;
       auto&& pu = points[u];
-      Point_d m = k.midpoint_d_object()(pu, points[v]);
-      FT r = k.squared_distance_d_object()(m, pu);
+      Point_d m = kernel.midpoint_d_object()(pu, points[v]);
+      FT r = kernel.squared_distance_d_object()(m, pu);
       if (exact) CGAL::exact(r);
-      complex.assign_key(sh, cache_.size());
-      complex.assign_filtration(sh, max(cvt(r), Filtration_value(0)));
-      cache_.emplace_back(std::move(m), std::move(r));
+      meb.filtration = max(cvt(r), Filtration_value(0));
+      meb.sphere.emplace(std::move(m), std::move(r));
     } else if (dim > ambient_dim) {
       // The sphere is always defined by at most d+1 points
       Filtration_value maxf = 0; // max filtration of the faces
       for (auto face : complex.boundary_simplex_range(sh)) {
         maxf = max(maxf, complex.filtration(face));
       }
-      complex.assign_filtration(sh, maxf);
+      meb.filtration = maxf;
     } else {
       Filtration_value maxf = 0; // max filtration of the faces
-      bool found = false;
       for (auto face_opposite_vertex : complex.boundary_opposite_vertex_simplex_range(sh)) {
         maxf = max(maxf, complex.filtration(face_opposite_vertex.first));
-        if (!found) {
+        if (!meb.facet_key) {
           auto key = complex.key(face_opposite_vertex.first);
           Sphere const& sph = cache_[key];
-          if (k.squared_distance_d_object()(sph.first, points[face_opposite_vertex.second]) > sph.second) continue;
-          found = true;
-          complex.assign_key(sh, key);
+          if (kernel.squared_distance_d_object()(sph.first, points[face_opposite_vertex.second]) > sph.second) continue;
+          meb.facet_key = key;
           // With exact computations, we could stop here
           // complex.assign_filtration(sh, complex.filtration(face_opposite_vertex.first)); return;
           // but because of possible rounding errors, we continue with the equivalent of make_filtration_non_decreasing
         }
       }
-      if (!found) {
+      if (!meb.facet_key) {
         // None of the faces are good enough, MEB must be the circumsphere.
         pts.clear();
         for (auto vertex : complex.simplex_vertex_range(sh))
           pts.push_back(points[vertex]);
-        Point_d c = k.construct_circumcenter_d_object()(pts.begin(), pts.end());
-        FT r = k.squared_distance_d_object()(c, pts.front());
+        Point_d c = kernel.construct_circumcenter_d_object()(pts.begin(), pts.end());
+        FT r = kernel.squared_distance_d_object()(c, pts.front());
         if (exact) CGAL::exact(r);
         // For Epick_d, if the circumcenter computation is too unstable, we could compute
         //   int d2 = dim * dim;
         //   Filtration_value max_sanity = maxf * d2 / (d2 - 1);
         // and use min(max_sanity, ...), which would limit how bad numerical errors can be.
         maxf = max(maxf, cvt(r)); // maxf = cvt(r) except for rounding errors
-        complex.assign_key(sh, cache_.size());
         // We could check if the simplex is maximal and avoiding adding it to the cache in that case.
-        cache_.emplace_back(std::move(c), std::move(r));
+        meb.sphere.emplace(std::move(c), std::move(r));
       }
-      complex.assign_filtration(sh, maxf);
+      meb.filtration = maxf;
+    }
+    return meb;
+  };
+  // Sequential, so that the keys are the positions in the cache
+  auto store_MEB = [&](Simplex_handle sh, MEB& meb) {
+    if (meb.sphere) {
+      complex.assign_key(sh, cache_.size());
+      cache_.push_back(std::move(*meb.sphere));
+    } else if (meb.facet_key) {
+      complex.assign_key(sh, *meb.facet_key);
     }
+    complex.assign_filtration(sh, meb.filtration);
   };
-  complex.for_each_simplex(fun);
+
+#ifdef GUDHI_USE_TBB
+  // The points of lazy exact kernels like Epeck_d share their exact representation, which is not thread safe.
+  if constexpr (std::is_floating_point_v<FT>) {
+    // Dimension by dimension, since the MEB of a simplex only depends on the ones of its facets
+    std::vector<std::vector<Simplex_handle>> simplices_by_dim;
+    complex.for_each_simplex([&](Simplex_handle sh, int dim) {
+      if (dim == 0) {
+        complex.assign_filtration(sh, 0);
+        return;
+      }
+      if (static_cast<std::size_t>(dim) >= simplices_by_dim.size()) simplices_by_dim.resize(dim + 1);
+      simplices_by_dim[dim].push_back(sh);
+    });
+    using Local_data = std::pair<std::decay_t<Kernel>, std::vector<Point_d>>;
+    tbb::enumerable_thread_specific<Local_data> local_data([&k]() { return Local_data(k, {}); });
+    std::vector<MEB> mebs;
+    for (int dim = 1; dim < static_cast<int>(simplices_by_dim.size()); ++dim) {
+      auto const& simplices = simplices_by_dim[dim];
+      mebs.assign(simplices.size(), MEB{0, std::nullopt, std::nullopt});
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, simplices.size()),
+                        [&](const tbb::blocked_range<std::size_t>& range) {
+                          auto& [kernel, pts] = local_data.local();
+                          for (std::size_t i = range.begin(); i != range.end(); ++i)
+                            mebs[i] = compute_MEB(kernel, pts, simplices[i], dim);
+                        });
+      for (std::size_t i = 0; i < simplices.size(); ++i) store_MEB(simplices[i], mebs[i]);
+    }
+    return;
+  }
+#endif
+  std::vector<Point_d> pts;
+  complex.for_each_simplex([&](Simplex_handle sh, int dim) {
+    if (dim == 0) {
+      complex.assign_filtration(sh, 0);
+    } else {
+      MEB meb = compute_MEB(k, pts, sh, dim);
+      store_MEB(sh, meb);
+    }
+  });
 
   // We could avoid computing maxf, but when !exact rounding errors may cause
   // the filtration values to be non-monotonous, so we would need to call
@@ -26,6 +26,9 @@
 #include <gudhi/Unitary_tests_utils.h>
 
 #include <CGAL/Epeck_d.h>  // For EXACT or SAFE version
+#include <CGAL/Epick_d.h>
+
+#include <random>
 
 // Type definitions
 using Simplex_tree = Gudhi::Simplex_tree<>;
@@ -272,3 +275,28 @@ BOOST_AUTO_TEST_CASE(Cech_create_complex_throw) {
   BOOST_CHECK_THROW(cech_complex_from_file.create_complex(stree, 1), std::invalid_argument);
 }
 #endif
+
+BOOST_AUTO_TEST_CASE(MEB_filtration_with_inexact_kernel) {
+  // With TBB, assign_MEB_filtration is parallel for Epick_d, and still sequential for Epeck_d
+  using Fast_kernel = CGAL::Epick_d<CGAL::Dimension_tag<3>>;
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  Point_cloud points;
+  std::vector<Fast_kernel::Point_d> fast_points;
+  for (int i = 0; i < 100; ++i) {
+    std::vector<double> coords{unif(gen), unif(gen), unif(gen)};
+    points.emplace_back(coords.begin(), coords.end());
+    fast_points.emplace_back(coords.begin(), coords.end());
+  }
+  Simplex_tree st;
+  Cech_complex(points, 0.3).create_complex(st, 4);
+  Simplex_tree fast_st = st;
+  Gudhi::cech_complex::assign_MEB_filtration(Kernel(), st, points);
+  Gudhi::cech_complex::assign_MEB_filtration(Fast_kernel(), fast_st, fast_points);
+  std::clog << "MEB filtration of " << st.num_simplices() << " simplices" << std::endl;
+  auto sh = st.complex_simplex_range().begin();
+  for (auto fast_sh : fast_st.complex_simplex_range()) {
+    GUDHI_TEST_FLOAT_EQUALITY_CHECK(fast_st.filtration(fast_sh), st.filtration(*sh), 1e-10);
+    ++sh;
+  }
+}
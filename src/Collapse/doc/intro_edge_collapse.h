@@ -54,6 +54,10 @@ namespace collapse {
  * The algorithm implemented here does not produce a minimal filtration. Taking its output and applying the algorithm a
  * second time may further simplify the filtration.
  *
+ * The edges are processed one after the other in decreasing order of filtration value.
+ * `Gudhi::collapse::flag_complex_collapse_edges_in_parallel()` computes the same result, but tests the domination of
+ * consecutive edges concurrently, and tests an edge again only if an earlier one modified its neighborhood.
+ *
  * \subsection edgecollapseexample Basic edge collapse
  * 
  * This example calls `Gudhi::collapse::flag_complex_collapse_edges()` from a proximity graph represented as a list of
@@ -71,6 +75,15 @@ namespace collapse {
  * the program output could be:
  * 
  * \include edge_collapse_example_basic.txt
+ *
+ * \subsection edgecollapseripspersistence Persistence of a Rips filtration after collapse
+ *
+ * `Gudhi::collapse::Rips_persistence` runs the whole pipeline in one call: it computes the edges of the Rips graph,
+ * collapses them, expands the flag complex of the remaining edges in a `Gudhi::Simplex_tree` and computes its
+ * persistence, freeing each intermediate structure once it has been consumed. It also reports the time spent in each
+ * of these stages.
+ *
+ * \include edge_collapse_rips_persistence.cpp
  */
 /** @} */  // end defgroup strong_collapse
 
@@ -0,0 +1,46 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Rips_persistence.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Points_off_io.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using Point = std::vector<double>;
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <OFF input file> <max_edge_length>\n";
+    return -1;
+  }
+  Gudhi::Points_off_reader<Point> off_reader(argv[1]);
+  if (!off_reader.is_valid()) {
+    std::cerr << "Unable to read file " << argv[1] << "\n";
+    return -1;
+  }
+  double threshold = std::stod(argv[2]);
+
+  // Persistence up to dimension 2, with Z/2Z coefficients, after one edge collapse
+  Gudhi::collapse::Rips_persistence<> rips_persistence(2, 2);
+  auto const& diagram =
+      rips_persistence.compute_persistence(off_reader.get_point_cloud(), threshold, Gudhi::Euclidean_distance());
+
+  std::cout << rips_persistence.num_edges_before_collapse() << " edges collapsed to "
+            << rips_persistence.num_edges_after_collapse() << ", complex of "
+            << rips_persistence.num_simplices() << " simplices\n";
+  auto const& timings = rips_persistence.timings();
+  std::cout << "Edges: " << timings.edges << "s, collapse: " << timings.collapse
+            << "s, expansion: " << timings.expansion << "s, persistence: " << timings.persistence << "s\n";
+  for (auto const& [dim, birth, death] : diagram) std::cout << dim << " " << birth << " " << death << "\n";
+  return 0;
+}
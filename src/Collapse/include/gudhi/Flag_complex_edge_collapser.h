@@ -20,6 +20,9 @@
 
 #ifdef GUDHI_USE_TBB
 #include <tbb/parallel_sort.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
 #endif
 
 #include <utility>
@@ -54,11 +57,19 @@ struct Flag_complex_edge_collapser {
   // Minimal matrix interface
   // Using this matrix generally helps performance, but the memory use may be excessive for a very sparse graph
   // (and in extreme cases the constant initialization of the matrix may start to dominate the running time).
+  // So it is only allocated if the graph is dense enough: if the matrix has at most dense_array_max_ratio times more
+  // entries than the neighbor lists. Otherwise, the lookups are done in the neighbor lists, like without the macro,
+  // and the memory stays linear in the number of edges.
   // Are there cases where the matrix is too big but a hash table would help?
+  double dense_array_max_ratio = 16;
+  bool use_dense_array = false;
   std::vector<Filtration_value> neighbors_data;
-  void init_neighbors_dense(){
+  void init_neighbors_dense(std::size_t num_edges){
     neighbors_data.clear();
-    neighbors_data.resize(num_vertices*num_vertices, std::numeric_limits<Filtration_value>::infinity());
+    use_dense_array = static_cast<double>(num_vertices) * num_vertices <=
+                      dense_array_max_ratio * static_cast<double>(2 * num_edges + num_vertices);
+    if(use_dense_array)
+      neighbors_data.resize(num_vertices*num_vertices, std::numeric_limits<Filtration_value>::infinity());
   }
   Filtration_value& neighbors_dense(Vertex i, Vertex j){return neighbors_data[num_vertices*j+i];}
 #endif
@@ -68,24 +79,30 @@ struct Flag_complex_edge_collapser {
     neighbors[u][v]=f;
     neighbors[v][u]=f;
 #ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
-    neighbors_dense(u,v)=f;
-    neighbors_dense(v,u)=f;
+    if(use_dense_array){
+      neighbors_dense(u,v)=f;
+      neighbors_dense(v,u)=f;
+    }
 #endif
   }
   void remove_neighbor(Vertex u, Vertex v) {
     neighbors[u].erase(v);
     neighbors[v].erase(u);
 #ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
-    neighbors_dense(u,v)=std::numeric_limits<Filtration_value>::infinity();
-    neighbors_dense(v,u)=std::numeric_limits<Filtration_value>::infinity();
+    if(use_dense_array){
+      neighbors_dense(u,v)=std::numeric_limits<Filtration_value>::infinity();
+      neighbors_dense(v,u)=std::numeric_limits<Filtration_value>::infinity();
+    }
 #endif
   }
 
   template<class FilteredEdgeRange>
-  void read_edges(FilteredEdgeRange const&r){
+  void read_edges(FilteredEdgeRange const&r, std::size_t num_edges){
     neighbors.resize(num_vertices);
 #ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
-    init_neighbors_dense();
+    init_neighbors_dense(num_edges);
+#else
+    (void)num_edges;
 #endif
     // Use the raw sequence to avoid maintaining the order
     std::vector<typename Ngb_list::sequence_type> neighbors_seq(num_vertices);
@@ -97,15 +114,18 @@ struct Flag_complex_edge_collapser {
       neighbors_seq[u].emplace_back(v, f);
       neighbors_seq[v].emplace_back(u, f);
 #ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
-      neighbors_dense(u,v)=f;
-      neighbors_dense(v,u)=f;
+      if(use_dense_array){
+        neighbors_dense(u,v)=f;
+        neighbors_dense(v,u)=f;
+      }
 #endif
     }
     for(std::size_t i=0;i<neighbors_seq.size();++i){
       neighbors_seq[i].emplace_back(i, -std::numeric_limits<Filtration_value>::infinity());
       neighbors[i].adopt_sequence(std::move(neighbors_seq[i])); // calls sort
 #ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
-      neighbors_dense(i,i)=-std::numeric_limits<Filtration_value>::infinity();
+      if(use_dense_array)
+        neighbors_dense(i,i)=-std::numeric_limits<Filtration_value>::infinity();
 #endif
     }
   }
@@ -147,12 +167,14 @@ struct Flag_complex_edge_collapser {
     // how (un)balanced the sizes of e_ngb and nc are.
     // Some efficient operations on sets work best with bitsets, although the need for a map complicates things.
 #ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
-    for(auto v : e_ngb) {
-      // if(v==c)continue;
-      if(neighbors_dense(v,c) > f) return false;
+    if(use_dense_array){
+      for(auto v : e_ngb) {
+        // if(v==c)continue;
+        if(neighbors_dense(v,c) > f) return false;
+      }
+      return true;
     }
-    return true;
-#else
+#endif
     auto&&nc = neighbors[c];
     // if few neighbors, use dichotomy? Seems slower.
     // I tried storing a copy of neighbors as a vector<absl::flat_hash_map> and using it for nc, but it was
@@ -181,100 +203,183 @@ struct Flag_complex_edge_collapser {
       // if(*eni == c && ++eni == ene)return true;
       if(++ci == ce) return false;
     }
-#endif
   }
 
-  template<class FilteredEdgeRange, class Delay>
-  void process_edges(FilteredEdgeRange const& edges, Delay&& delay) {
-    {
-      Vertex maxi = 0, maxj = 0;
-      for(auto& fe : edges) {
-        Vertex i = std::get<0>(fe);
-        Vertex j = std::get<1>(fe);
-        if (i > maxi) maxi = i;
-        if (j > maxj) maxj = j;
+  // Computes the fate of the edge uv, which appears at `time`, from the current neighborhoods without modifying
+  // them: returns whether the edge can be removed and, if not, the time until which it can be delayed.
+  // The buffers e_ngb and e_ngb_later are overwritten. On return, their union (whatever the order of e_ngb_later)
+  // is the set of common neighbors of u and v, and those neighborhoods, with the ones of u and v, are all that was read.
+  std::pair<bool, Filtration_value> collapse_edge(boost::container::flat_set<Vertex>& e_ngb,
+      std::vector<std::pair<Filtration_value, Vertex>>& e_ngb_later, Vertex u, Vertex v, Filtration_value time) {
+    e_ngb.clear();
+    e_ngb_later.clear();
+    common_neighbors(e_ngb, e_ngb_later, u, v, time);
+    // If we identify a good candidate (the first common neighbor) for being a dominator of e until infinity,
+    // we could check that a bit more cheaply. It does not seem to help though.
+    auto cmp1=[](auto const&a, auto const&b){return a.first > b.first;};
+    auto e_ngb_later_begin=e_ngb_later.begin();
+    auto e_ngb_later_end=e_ngb_later.end();
+    bool heapified = false;
+
+    while(true) {
+      Vertex dominator = -1;
+      // special case for size 1
+      // if(e_ngb.size()==1){dominator=*e_ngb.begin();}else
+      // It is tempting to test the dominators in increasing order of filtration value, which is likely to reduce
+      // the number of calls to is_dominated_by before finding a dominator, but sorting, even partially / lazily,
+      // is very expensive.
+      for(auto c : e_ngb){
+        if(is_dominated_by(e_ngb, c, time)){
+          dominator = c;
+          break;
+        }
       }
-      num_vertices = std::max(maxi, maxj) + 1;
+      if(dominator==-1) return {false, time};
+      // Push as long as dominator remains a dominator.
+      // Iterate on times where at least one neighbor appears.
+      for (bool still_dominated = true; still_dominated; ) {
+        if(e_ngb_later_begin == e_ngb_later_end) return {true, time};
+        if(!heapified) {
+          // Eagerly sorting can be slow
+          std::make_heap(e_ngb_later_begin, e_ngb_later_end, cmp1);
+          heapified=true;
+        }
+        time = e_ngb_later_begin->first; // first place it may become critical
+        // Update the neighborhood for this new time, while checking if any of the new neighbors break domination.
+        while (e_ngb_later_begin != e_ngb_later_end && e_ngb_later_begin->first <= time) {
+          Vertex w = e_ngb_later_begin->second;
+#ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
+          if(use_dense_array) {
+            if (neighbors_dense(dominator,w) > e_ngb_later_begin->first)
+              still_dominated = false;
+          } else
+#endif
+          {
+            auto& ngb_dom = neighbors[dominator];
+            auto wit = ngb_dom.find(w); // neighborhood may be open or closed, it does not matter
+            if (wit == ngb_dom.end() || wit->second > e_ngb_later_begin->first)
+              still_dominated = false;
+          }
+          e_ngb.insert(w);
+          std::pop_heap(e_ngb_later_begin, e_ngb_later_end--, cmp1);
+        }
+      } // this doesn't seem to help that much...
     }
+  }
 
-    read_edges(edges);
+  // Applies the result of collapse_edge to the neighborhoods and to the output.
+  // Returns true if the neighborhoods were modified.
+  bool commit_edge(Vertex u, Vertex v, Filtration_value input_time, Filtration_value start_time,
+                   std::pair<bool, Filtration_value> fate) {
+    if(fate.first) {
+      remove_neighbor(u, v);
+      return true;
+    } else if(start_time != fate.second) {
+      delay_neighbor(u, v, fate.second);
+      res.emplace_back(u, v, fate.second);
+      return true;
+    } else {
+      res.emplace_back(u, v, input_time);
+      return false;
+    }
+  }
+
+  template<class FilteredEdgeRange>
+  void init(FilteredEdgeRange const& edges) {
+    Vertex maxi = 0, maxj = 0;
+    std::size_t num_edges = 0;
+    for(auto& fe : edges) {
+      ++num_edges;
+      Vertex i = std::get<0>(fe);
+      Vertex j = std::get<1>(fe);
+      if (i > maxi) maxi = i;
+      if (j > maxj) maxj = j;
+    }
+    num_vertices = std::max(maxi, maxj) + 1;
+
+    read_edges(edges, num_edges);
+  }
+
+  template<class FilteredEdgeRange, class Delay>
+  void process_edges(FilteredEdgeRange const& edges, Delay&& delay) {
+    init(edges);
 
     boost::container::flat_set<Vertex> e_ngb;
     e_ngb.reserve(num_vertices);
     std::vector<std::pair<Filtration_value, Vertex>> e_ngb_later;
     for(auto&e:edges) {
-      {
+      Vertex u = std::get<0>(e);
+      Vertex v = std::get<1>(e);
+      Filtration_value input_time = std::get<2>(e);
+      auto time = delay(input_time);
+      commit_edge(u, v, input_time, time, collapse_edge(e_ngb, e_ngb_later, u, v, time));
+    }
+  }
+
+#ifdef GUDHI_USE_TBB
+  // Same result as process_edges, but the edges are handled by windows of window_size consecutive edges. The fate of
+  // all the edges of a window is first computed concurrently from the neighborhoods at the beginning of the window,
+  // then the results are committed in order. The edge uv reads the entries (a,b) of the neighborhoods for a and b in
+  // S = {u, v} U common neighbors of u and v, and committing an edge ab only modifies the entry (a,b). So the
+  // speculative result of uv is still valid unless an earlier edge of the window with both vertices in S was
+  // removed or delayed, in which case it is computed again. The edges have to be in a random access range.
+  // delay is called concurrently.
+  template<class FilteredEdgeRange, class Delay>
+  void process_edges_in_parallel(FilteredEdgeRange const& edges, Delay&& delay, std::size_t window_size) {
+    init(edges);
+    window_size = std::max<std::size_t>(window_size, 1);
+
+    struct Buffers {
+      boost::container::flat_set<Vertex> e_ngb;
+      std::vector<std::pair<Filtration_value, Vertex>> e_ngb_later;
+    };
+    struct Speculation {
+      Filtration_value start_time;
+      std::pair<bool, Filtration_value> fate;
+      std::vector<Vertex> read_vertices;  // S, see above
+    };
+    tbb::enumerable_thread_specific<Buffers> buffers;
+    std::vector<Speculation> window(std::min<std::size_t>(window_size, edges.size()));
+    // modified_in[w] == k + 1 if an edge adjacent to w was modified in the k-th window
+    std::vector<std::size_t> modified_in(num_vertices, 0);
+    Buffers& main_buffers = buffers.local();
+
+    for(std::size_t begin = 0, k = 1; begin < edges.size(); begin += window_size, ++k) {
+      std::size_t end = std::min(begin + window_size, edges.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(begin, end), [&](tbb::blocked_range<std::size_t> const& r) {
+        Buffers& b = buffers.local();
+        for(std::size_t i = r.begin(); i != r.end(); ++i) {
+          auto& e = edges[i];
+          Vertex u = std::get<0>(e);
+          Vertex v = std::get<1>(e);
+          Speculation& s = window[i - begin];
+          s.start_time = delay(std::get<2>(e));
+          s.fate = collapse_edge(b.e_ngb, b.e_ngb_later, u, v, s.start_time);
+          s.read_vertices.assign(b.e_ngb.begin(), b.e_ngb.end());
+          for(auto& p : b.e_ngb_later) s.read_vertices.push_back(p.second);
+          s.read_vertices.push_back(u);
+          s.read_vertices.push_back(v);
+        }
+      });
+      for(std::size_t i = begin; i != end; ++i) {
+        auto& e = edges[i];
         Vertex u = std::get<0>(e);
         Vertex v = std::get<1>(e);
-        Filtration_value input_time = std::get<2>(e);
-        auto time = delay(input_time);
-        auto start_time = time;
-        e_ngb.clear();
-        e_ngb_later.clear();
-        common_neighbors(e_ngb, e_ngb_later, u, v, time);
-        // If we identify a good candidate (the first common neighbor) for being a dominator of e until infinity,
-        // we could check that a bit more cheaply. It does not seem to help though.
-        auto cmp1=[](auto const&a, auto const&b){return a.first > b.first;};
-        auto e_ngb_later_begin=e_ngb_later.begin();
-        auto e_ngb_later_end=e_ngb_later.end();
-        bool heapified = false;
-
-        bool dead = false;
-        while(true) {
-          Vertex dominator = -1;
-          // special case for size 1
-          // if(e_ngb.size()==1){dominator=*e_ngb.begin();}else
-          // It is tempting to test the dominators in increasing order of filtration value, which is likely to reduce
-          // the number of calls to is_dominated_by before finding a dominator, but sorting, even partially / lazily,
-          // is very expensive.
-          for(auto c : e_ngb){
-            if(is_dominated_by(e_ngb, c, time)){
-              dominator = c;
-              break;
-            }
-          }
-          if(dominator==-1) break;
-          // Push as long as dominator remains a dominator.
-          // Iterate on times where at least one neighbor appears.
-          for (bool still_dominated = true; still_dominated; ) {
-            if(e_ngb_later_begin == e_ngb_later_end) {
-              dead = true; goto end_move;
-            }
-            if(!heapified) {
-              // Eagerly sorting can be slow
-              std::make_heap(e_ngb_later_begin, e_ngb_later_end, cmp1);
-              heapified=true;
-            }
-            time = e_ngb_later_begin->first; // first place it may become critical
-            // Update the neighborhood for this new time, while checking if any of the new neighbors break domination.
-            while (e_ngb_later_begin != e_ngb_later_end && e_ngb_later_begin->first <= time) {
-              Vertex w = e_ngb_later_begin->second;
-#ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
-              if (neighbors_dense(dominator,w) > e_ngb_later_begin->first)
-                still_dominated = false;
-#else
-              auto& ngb_dom = neighbors[dominator];
-              auto wit = ngb_dom.find(w); // neighborhood may be open or closed, it does not matter
-              if (wit == ngb_dom.end() || wit->second > e_ngb_later_begin->first)
-                still_dominated = false;
-#endif
-              e_ngb.insert(w);
-              std::pop_heap(e_ngb_later_begin, e_ngb_later_end--, cmp1);
-            }
-          } // this doesn't seem to help that much...
-        }
-end_move:
-        if(dead) {
-          remove_neighbor(u, v);
-        } else if(start_time != time) {
-          delay_neighbor(u, v, time);
-          res.emplace_back(u, v, time);
-        } else {
-          res.emplace_back(u, v, input_time);
+        Speculation& s = window[i - begin];
+        // Conservative test: two modified vertices of S do not always come from the same modified edge.
+        int modified_read_vertices = 0;
+        for(Vertex w : s.read_vertices)
+          if(modified_in[w] == k && ++modified_read_vertices == 2) break;
+        if(modified_read_vertices == 2)
+          s.fate = collapse_edge(main_buffers.e_ngb, main_buffers.e_ngb_later, u, v, s.start_time);
+        if(commit_edge(u, v, std::get<2>(e), s.start_time, s.fate)) {
+          modified_in[u] = k;
+          modified_in[v] = k;
         }
       }
     }
   }
+#endif
 
   std::vector<Filtered_edge> output() {
     return std::move(res);
@@ -285,6 +390,17 @@ end_move:
 template<class R> R to_range(R&& r) { return std::move(r); }
 template<class R, class T> R to_range(T const& t) { R r; r.insert(r.end(), t.begin(), t.end()); return r; }
 
+template<class Filtered_edge>
+void sort_by_decreasing_filtration(std::vector<Filtered_edge>& edges) {
+#ifdef GUDHI_USE_TBB
+  // I think this sorting is always negligible compared to the collapse, but parallelizing it shouldn't hurt.
+  tbb::parallel_sort(edges.begin(), edges.end(),
+      [](auto const&a, auto const&b){return std::get<2>(a)>std::get<2>(b);});
+#else
+  std::sort(edges.begin(), edges.end(), [](auto const&a, auto const&b){return std::get<2>(a)>std::get<2>(b);});
+#endif
+}
+
 template<class FilteredEdgeRange, class Delay>
 auto flag_complex_collapse_edges(FilteredEdgeRange&& edges, Delay&&delay) {
   // Would it help to label the points according to some spatial sorting?
@@ -294,15 +410,30 @@ auto flag_complex_collapse_edges(FilteredEdgeRange&& edges, Delay&&delay) {
   using Edge_collapser = Flag_complex_edge_collapser<Vertex, Filtration_value>;
   if (first_edge_itr != std::end(edges)) {
     auto edges2 = to_range<std::vector<typename Edge_collapser::Filtered_edge>>(std::forward<FilteredEdgeRange>(edges));
+    sort_by_decreasing_filtration(edges2);
+    Edge_collapser edge_collapser;
+    edge_collapser.process_edges(edges2, std::forward<Delay>(delay));
+    return edge_collapser.output();
+  }
+  return std::vector<typename Edge_collapser::Filtered_edge>();
+}
+
+template<class FilteredEdgeRange, class Delay>
+auto flag_complex_collapse_edges_in_parallel(FilteredEdgeRange&& edges, Delay&&delay, std::size_t window_size) {
+  auto first_edge_itr = std::begin(edges);
+  using Vertex = std::decay_t<decltype(std::get<0>(*first_edge_itr))>;
+  using Filtration_value = std::decay_t<decltype(std::get<2>(*first_edge_itr))>;
+  using Edge_collapser = Flag_complex_edge_collapser<Vertex, Filtration_value>;
+  if (first_edge_itr != std::end(edges)) {
+    auto edges2 = to_range<std::vector<typename Edge_collapser::Filtered_edge>>(std::forward<FilteredEdgeRange>(edges));
+    sort_by_decreasing_filtration(edges2);
+    Edge_collapser edge_collapser;
 #ifdef GUDHI_USE_TBB
-    // I think this sorting is always negligible compared to the collapse, but parallelizing it shouldn't hurt.
-    tbb::parallel_sort(edges2.begin(), edges2.end(),
-        [](auto const&a, auto const&b){return std::get<2>(a)>std::get<2>(b);});
+    edge_collapser.process_edges_in_parallel(edges2, std::forward<Delay>(delay), window_size);
 #else
-    std::sort(edges2.begin(), edges2.end(), [](auto const&a, auto const&b){return std::get<2>(a)>std::get<2>(b);});
-#endif
-    Edge_collapser edge_collapser;
+    (void)window_size;
     edge_collapser.process_edges(edges2, std::forward<Delay>(delay));
+#endif
     return edge_collapser.output();
   }
   return std::vector<typename Edge_collapser::Filtered_edge>();
@@ -323,13 +454,44 @@ auto flag_complex_collapse_edges(FilteredEdgeRange&& edges, Delay&&delay) {
  *
  * \note
  * Advanced: Defining the macro GUDHI_COLLAPSE_USE_DENSE_ARRAY tells gudhi to allocate a square table of size the
- * maximum vertex index. This usually speeds up the computation for dense graphs. However, for sparse graphs, the memory
- * use may be problematic and initializing this large table may be slow.
+ * maximum vertex index when the graph is dense enough, i.e. when the table has at most 16 times more entries than
+ * twice the number of edges. This usually speeds up the computation for dense graphs. For sparser graphs, where the
+ * memory use would be problematic and initializing this large table slow, the neighbor lists are used instead and the
+ * memory stays linear in the number of edges.
  */
 template<class FilteredEdgeRange> auto flag_complex_collapse_edges(const FilteredEdgeRange& edges) {
   return flag_complex_collapse_edges(edges, [](auto const&d){return d;});
 }
 
+/** \brief Same as `flag_complex_collapse_edges(const FilteredEdgeRange&)`, with the same result, but the domination
+ * tests are run concurrently.
+ *
+ * The edges are processed by windows of `window_size` consecutive edges in the filtration order. The domination tests
+ * of all the edges of a window are first run in parallel, speculating that the other edges of the window do not
+ * change the graph. The results are then committed in order, and the test of an edge is run again if an earlier edge
+ * of the window modified the part of the graph it depends on. Larger windows expose more parallelism, but more tests
+ * are run again when the graph is small or dense.
+ *
+ * \param[in] edges Range of Filtered edges. There is no need for the range to be sorted, as it will be done internally.
+ * \param[in] window_size Number of edges tested concurrently.
+ *
+ * \tparam FilteredEdgeRange Range of `std::tuple<Vertex_handle, Vertex_handle, Filtration_value>`
+ * where `Vertex_handle` is the type of a vertex index.
+ *
+ * \return Remaining edges after collapse as a range of
+ * `std::tuple<Vertex_handle, Vertex_handle, Filtration_value>`.
+ *
+ * \ingroup edge_collapse
+ *
+ * \note
+ * Without TBB (when `GUDHI_USE_TBB` is not defined), this function is
+ * sequential and equivalent to `flag_complex_collapse_edges(const FilteredEdgeRange&)`.
+ */
+template<class FilteredEdgeRange>
+auto flag_complex_collapse_edges_in_parallel(const FilteredEdgeRange& edges, std::size_t window_size = 1024) {
+  return flag_complex_collapse_edges_in_parallel(edges, [](auto const&d){return d;}, window_size);
+}
+
 }  // namespace collapse
 
 }  // namespace Gudhi
@@ -0,0 +1,194 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef RIPS_PERSISTENCE_H_
+#define RIPS_PERSISTENCE_H_
+
+#include <gudhi/Flag_complex_edge_collapser.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Clock.h>
+
+#include <boost/range/irange.hpp>
+
+#include <algorithm>  // for std::stable_sort
+#include <cstddef>  // for std::size_t
+#include <stdexcept>
+#include <tuple>
+#include <utility>  // for std::move
+#include <vector>
+
+namespace Gudhi {
+
+namespace collapse {
+
+/**
+ * \class Rips_persistence
+ * \brief Computes the persistence diagram of a Rips filtration, collapsing its edges before the expansion.
+ *
+ * \ingroup edge_collapse
+ *
+ * \details
+ * This is the pipeline of the `point_cloud_edge_collapse_rips_persistence` utility in one call: the edges of the
+ * Rips graph are computed as in `Gudhi::rips_complex::Rips_complex`, moved to
+ * `Gudhi::collapse::flag_complex_collapse_edges()`, the remaining edges are inserted in a `Gudhi::Simplex_tree` with
+ * `Simplex_tree::insert_batch_edges`, the flag complex is expanded, and its persistence is computed with
+ * `Gudhi::persistent_cohomology::Persistent_cohomology`. Each intermediate structure is freed as soon as the next
+ * stage has consumed it, so that the peak memory is the one of the largest stage, and only the diagram is kept.
+ *
+ * The time spent in each stage is available after the computation with `timings()`.
+ *
+ * \tparam SimplexTree is the simplicial complex used for the expansion and the persistence, by default
+ * `Gudhi::Simplex_tree<>`. It must have the `insert_batch_vertices` and `insert_batch_edges` methods.
+ */
+template <typename SimplexTree = Simplex_tree<>>
+class Rips_persistence {
+ public:
+  using Filtration_value = typename SimplexTree::Filtration_value;
+  /** \brief A persistence interval, as dimension, birth and death. */
+  using Persistence_interval = std::tuple<int, Filtration_value, Filtration_value>;
+
+  /** \brief Time spent, in seconds, in each stage of the last computation. */
+  struct Timings {
+    /** \brief Computation of the edges of the Rips graph. */
+    double edges = 0.;
+    /** \brief Edge collapse, all iterations included. */
+    double collapse = 0.;
+    /** \brief Insertion of the remaining edges in the simplicial complex, and flag expansion. */
+    double expansion = 0.;
+    /** \brief Persistent cohomology. */
+    double persistence = 0.;
+  };
+
+  /** \brief Rips_persistence constructor.
+   *
+   * @param[in] max_homology_dimension Maximal dimension of the persistence intervals. The complex is expanded until
+   * dimension `max_homology_dimension + 1`.
+   * @param[in] homology_coeff_field Characteristic p of the coefficient field Z/pZ.
+   * @param[in] min_persistence Minimal lifetime of the intervals to be recorded.
+   * @param[in] collapse_iterations Number of times the edge collapse is performed. 0 computes the persistence of the
+   * Rips complex without any collapse.
+   * @exception std::invalid_argument If `max_homology_dimension` or `collapse_iterations` is negative.
+   */
+  Rips_persistence(int max_homology_dimension, int homology_coeff_field = 11, Filtration_value min_persistence = 0,
+                   int collapse_iterations = 1)
+      : max_homology_dimension_(max_homology_dimension),
+        homology_coeff_field_(homology_coeff_field),
+        min_persistence_(min_persistence),
+        collapse_iterations_(collapse_iterations) {
+    if (max_homology_dimension < 0 || collapse_iterations < 0)
+      throw std::invalid_argument("Rips_persistence - dimension and number of collapse iterations must be >= 0");
+  }
+
+  /** \brief Computes the persistence diagram of the Rips filtration of a point cloud.
+   *
+   * The parameters are the ones of the `Gudhi::rips_complex::Rips_complex` constructor from points, and the edges are
+   * computed the same way.
+   *
+   * @return The persistence diagram, sorted by dimension, then by decreasing lifetime.
+   */
+  template <typename ForwardPointRange, typename Distance>
+  const std::vector<Persistence_interval>& compute_persistence(const ForwardPointRange& points,
+                                                               Filtration_value threshold, Distance distance) {
+    Clock clock;
+    rips_complex::Rips_complex<Filtration_value> rips(points, threshold, distance);
+    timings_.edges = clock.num_seconds();
+    return compute_persistence_from_rips_graph(rips);
+  }
+
+  /** \brief Computes the persistence diagram of the Rips filtration of a distance matrix.
+   *
+   * The parameters are the ones of the `Gudhi::rips_complex::Rips_complex` constructor from a distance matrix.
+   *
+   * @return The persistence diagram, sorted by dimension, then by decreasing lifetime.
+   */
+  template <typename DistanceMatrix>
+  const std::vector<Persistence_interval>& compute_persistence(const DistanceMatrix& distance_matrix,
+                                                               Filtration_value threshold) {
+    Clock clock;
+    rips_complex::Rips_complex<Filtration_value> rips(distance_matrix, threshold);
+    timings_.edges = clock.num_seconds();
+    return compute_persistence_from_rips_graph(rips);
+  }
+
+  /** \brief Returns the persistence diagram of the last computation. */
+  const std::vector<Persistence_interval>& persistence_diagram() const { return diagram_; }
+
+  /** \brief Returns the time spent in each stage of the last computation. */
+  const Timings& timings() const { return timings_; }
+
+  /** \brief Returns the number of edges of the Rips graph, before the collapse, in the last computation. */
+  std::size_t num_edges_before_collapse() const { return num_edges_before_collapse_; }
+
+  /** \brief Returns the number of edges remaining after the collapse in the last computation. */
+  std::size_t num_edges_after_collapse() const { return num_edges_after_collapse_; }
+
+  /** \brief Returns the number of simplices of the expanded complex in the last computation. */
+  std::size_t num_simplices() const { return num_simplices_; }
+
+ private:
+  const std::vector<Persistence_interval>& compute_persistence_from_rips_graph(
+      rips_complex::Rips_complex<Filtration_value>& rips) {
+    using Vertex_handle = typename SimplexTree::Vertex_handle;
+    Clock clock;
+    const auto num_vertices = static_cast<Vertex_handle>(rips.num_vertices());
+    // The edges leave the Rips graph, and the input of each collapse is freed by the collapse itself
+    auto edges = rips.release_edges();
+    num_edges_before_collapse_ = edges.size();
+    for (int iter = 0; iter < collapse_iterations_; ++iter)
+      edges = flag_complex_collapse_edges(std::move(edges), [](auto const& d) { return d; });
+    num_edges_after_collapse_ = edges.size();
+    timings_.collapse = clock.num_seconds();
+
+    clock.begin();
+    SimplexTree stree;
+    // Vertices with a 0. filtration value, just like a Rips complex
+    stree.insert_batch_vertices(boost::irange(static_cast<Vertex_handle>(0), num_vertices));
+    stree.insert_batch_edges(edges);
+    edges = {};
+    stree.expansion(max_homology_dimension_ + 1);
+    num_simplices_ = stree.num_simplices();
+    timings_.expansion = clock.num_seconds();
+
+    clock.begin();
+    persistent_cohomology::Persistent_cohomology<SimplexTree, persistent_cohomology::Field_Zp> pcoh(stree);
+    pcoh.init_coefficients(homology_coeff_field_);
+    pcoh.compute_persistent_cohomology(min_persistence_);
+    diagram_.clear();
+    for (int dim = 0; dim <= max_homology_dimension_; ++dim) {
+      for (auto& interval : pcoh.intervals_in_dimension(dim))
+        diagram_.emplace_back(dim, interval.first, interval.second);
+    }
+    std::stable_sort(diagram_.begin(), diagram_.end(), [](auto const& a, auto const& b) {
+      if (std::get<0>(a) != std::get<0>(b)) return std::get<0>(a) < std::get<0>(b);
+      return std::get<2>(a) - std::get<1>(a) > std::get<2>(b) - std::get<1>(b);
+    });
+    timings_.persistence = clock.num_seconds();
+    return diagram_;
+  }
+
+  int max_homology_dimension_;
+  int homology_coeff_field_;
+  Filtration_value min_persistence_;
+  int collapse_iterations_;
+
+  std::vector<Persistence_interval> diagram_;
+  Timings timings_;
+  std::size_t num_edges_before_collapse_ = 0;
+  std::size_t num_edges_after_collapse_ = 0;
+  std::size_t num_simplices_ = 0;
+};
+
+}  // namespace collapse
+
+}  // namespace Gudhi
+
+#endif  // RIPS_PERSISTENCE_H_
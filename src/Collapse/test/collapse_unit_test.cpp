@@ -14,8 +14,10 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/mpl/list.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <gudhi/Flag_complex_edge_collapser.h>
+#include <gudhi/Rips_persistence.h>
 #include <gudhi/distance_functions.h>
 #include <gudhi/graph_simplicial_complex.h>
 
@@ -24,6 +26,8 @@
 #include <vector>
 #include <array>
 #include <cmath>
+#include <random>
+#include <algorithm>
 
 struct Simplicial_complex {
   using Vertex_handle = short;
@@ -196,3 +200,118 @@ BOOST_AUTO_TEST_CASE(collapse_from_proximity_graph) {
   BOOST_CHECK(filtration_is_edge_length_nb == 4);
   BOOST_CHECK(filtration_is_diagonal_length_nb == 1);
 }
+
+BOOST_AUTO_TEST_CASE(collapse_in_parallel_is_sequential) {
+  std::cout << "***** COLLAPSE IN PARALLEL *****" << std::endl;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<Filtration_value> unif(0., 1.);
+  std::vector<std::vector<Filtration_value>> point_cloud;
+  for (int i = 0; i < 200; ++i) point_cloud.push_back({unif(gen), unif(gen), unif(gen)});
+
+  using Proximity_graph = Gudhi::Proximity_graph<Simplicial_complex>;
+  Proximity_graph proximity_graph = Gudhi::compute_proximity_graph<Simplicial_complex>(point_cloud, 0.5,
+                                                                                       Gudhi::Euclidean_distance());
+  Filtered_edge_list filtered_edges;
+  for (auto edge : boost::make_iterator_range(edges(proximity_graph)))
+    filtered_edges.emplace_back(source(edge, proximity_graph), target(edge, proximity_graph),
+                                get(Gudhi::edge_filtration_t(), proximity_graph, edge));
+  // Many ties, to have several edges with the same filtration value in a window
+  Filtered_edge_list rounded_edges = filtered_edges;
+  for (auto& edge : rounded_edges) std::get<2>(edge) = std::round(std::get<2>(edge) * 10);
+
+  for (auto const& input : {filtered_edges, rounded_edges}) {
+    auto expected = Gudhi::collapse::flag_complex_collapse_edges(input);
+    std::cout << input.size() << " edges collapsed to " << expected.size() << std::endl;
+    BOOST_CHECK(expected.size() < input.size());
+    for (std::size_t window_size : {1, 7, 100, 1024, 100000}) {
+      auto remaining_edges = Gudhi::collapse::flag_complex_collapse_edges_in_parallel(input, window_size);
+      BOOST_CHECK(remaining_edges == expected);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(rips_persistence_with_and_without_collapse) {
+  std::cout << "***** RIPS PERSISTENCE WITH AND WITHOUT COLLAPSE *****" << std::endl;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  std::vector<std::vector<double>> point_cloud;
+  for (int i = 0; i < 100; ++i) point_cloud.push_back({unif(gen), unif(gen), unif(gen)});
+  std::vector<std::vector<double>> distance_matrix(point_cloud.size());
+  for (std::size_t i = 0; i < point_cloud.size(); ++i)
+    for (std::size_t j = 0; j < i; ++j)
+      distance_matrix[i].push_back(Gudhi::Euclidean_distance()(point_cloud[i], point_cloud[j]));
+
+  using Rips_persistence = Gudhi::collapse::Rips_persistence<>;
+  auto sorted = [](auto diagram) {
+    std::sort(diagram.begin(), diagram.end());
+    return diagram;
+  };
+  Rips_persistence without_collapse(2, 11, 0., 0);
+  auto expected = sorted(without_collapse.compute_persistence(point_cloud, 0.5, Gudhi::Euclidean_distance()));
+  BOOST_CHECK(without_collapse.num_edges_before_collapse() == without_collapse.num_edges_after_collapse());
+  std::cout << expected.size() << " intervals" << std::endl;
+  BOOST_CHECK(expected.size() > point_cloud.size());
+
+  for (int iterations : {1, 2}) {
+    Rips_persistence with_collapse(2, 11, 0., iterations);
+    auto diagram = with_collapse.compute_persistence(point_cloud, 0.5, Gudhi::Euclidean_distance());
+    std::cout << with_collapse.num_edges_before_collapse() << " edges collapsed to "
+              << with_collapse.num_edges_after_collapse() << ", " << with_collapse.num_simplices()
+              << " simplices instead of " << without_collapse.num_simplices() << std::endl;
+    BOOST_CHECK(with_collapse.num_edges_before_collapse() == without_collapse.num_edges_before_collapse());
+    BOOST_CHECK(with_collapse.num_edges_after_collapse() < with_collapse.num_edges_before_collapse());
+    BOOST_CHECK(with_collapse.num_simplices() < without_collapse.num_simplices());
+    BOOST_CHECK(sorted(diagram) == expected);
+    // By dimension, then by decreasing lifetime
+    for (std::size_t i = 1; i < diagram.size(); ++i) {
+      auto& [dim0, birth0, death0] = diagram[i - 1];
+      auto& [dim1, birth1, death1] = diagram[i];
+      BOOST_CHECK(dim0 < dim1 || (dim0 == dim1 && death0 - birth0 >= death1 - birth1));
+    }
+
+    auto const& timings = with_collapse.timings();
+    BOOST_CHECK(timings.edges >= 0. && timings.collapse >= 0. && timings.expansion >= 0. && timings.persistence >= 0.);
+
+    BOOST_CHECK(sorted(with_collapse.compute_persistence(distance_matrix, 0.5)) == expected);
+    BOOST_CHECK(sorted(with_collapse.persistence_diagram()) == expected);
+  }
+
+  BOOST_CHECK_THROW(Rips_persistence(-1), std::invalid_argument);
+  BOOST_CHECK_THROW(Rips_persistence(1, 11, 0., -1), std::invalid_argument);
+}
+
+#ifdef GUDHI_COLLAPSE_USE_DENSE_ARRAY
+BOOST_AUTO_TEST_CASE(collapse_with_and_without_dense_array) {
+  std::cout << "***** COLLAPSE WITH AND WITHOUT DENSE ARRAY *****" << std::endl;
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<Filtration_value> unif(0., 1.);
+  std::vector<std::vector<Filtration_value>> point_cloud;
+  for (int i = 0; i < 300; ++i) point_cloud.push_back({unif(gen), unif(gen)});
+
+  Filtered_edge_list filtered_edges;
+  for (Vertex_handle i = 0; i < 300; ++i)
+    for (Vertex_handle j = i + 1; j < 300; ++j) {
+      Filtration_value d = Gudhi::Euclidean_distance()(point_cloud[i], point_cloud[j]);
+      if (d < 0.1) filtered_edges.emplace_back(i, j, d);
+    }
+  std::sort(filtered_edges.begin(), filtered_edges.end(),
+            [](auto const& a, auto const& b) { return std::get<2>(a) > std::get<2>(b); });
+
+  using Edge_collapser = Gudhi::collapse::Flag_complex_edge_collapser<Vertex_handle, Filtration_value>;
+  auto identity = [](Filtration_value f) { return f; };
+  // The graph is sparse: with the default ratio, the dense array is not used
+  Edge_collapser sparse_collapser;
+  sparse_collapser.process_edges(filtered_edges, identity);
+  BOOST_CHECK(!sparse_collapser.use_dense_array);
+  BOOST_CHECK(sparse_collapser.neighbors_data.empty());
+
+  Edge_collapser dense_collapser;
+  dense_collapser.dense_array_max_ratio = std::numeric_limits<double>::infinity();
+  dense_collapser.process_edges(filtered_edges, identity);
+  BOOST_CHECK(dense_collapser.use_dense_array);
+
+  auto remaining_edges = sparse_collapser.output();
+  std::cout << filtered_edges.size() << " edges collapsed to " << remaining_edges.size() << std::endl;
+  BOOST_CHECK(remaining_edges == dense_collapser.output());
+}
+#endif
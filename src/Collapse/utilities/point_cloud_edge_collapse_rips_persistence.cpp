@@ -17,6 +17,7 @@
 
 #include <boost/program_options.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/irange.hpp>
 
 #include<utility>  // for std::pair
 #include<vector>
@@ -96,14 +97,9 @@ int main(int argc, char* argv[]) {
   }
 
   Simplex_tree stree;
-  for (Vertex_handle vertex = 0; static_cast<std::size_t>(vertex) < point_vector.size(); vertex++) {
-    // insert the vertex with a 0. filtration value just like a Rips
-    stree.insert_simplex({vertex}, 0.);
-  }
-
-  for (auto filtered_edge : edges_list) {
-    stree.insert_simplex({std::get<0>(filtered_edge), std::get<1>(filtered_edge)}, std::get<2>(filtered_edge));
-  }
+  // insert the vertices with a 0. filtration value just like a Rips
+  stree.insert_batch_vertices(boost::irange(static_cast<Vertex_handle>(0), static_cast<Vertex_handle>(point_vector.size())));
+  stree.insert_batch_edges(edges_list);
 
   stree.expansion(dim_max);
   
@@ -57,6 +57,7 @@ using ssize_t = std::make_signed_t<std::size_t>;
 #include <utility>    // for std::pair<>
 #include <algorithm>  // for (std::max)
 #include <random>
+#include <type_traits>  // for std::is_same
 #include <cassert>
 #include <cmath>
 
@@ -405,13 +406,36 @@ class Cover_complex {
     std::vector<double> zeros(this->num_points);
     for (int i = 0; i < this->num_points; i++) distances.push_back(zeros);
     if (verbose) std::clog << "Computing distances..." << std::endl;
-    for (int i = 0; i < this->num_points; i++) {
-      int state = 100 * (i + 1) / this->num_points;
-      if (verbose && state % 10 == 0) std::clog << "\r" << state << "%" << std::flush;
-      for (int j = i; j < this->num_points; j++) {
-        double dis = ref_distance(point_cloud[i], point_cloud[j]);
-        distances[i][j] = dis;
-        distances[j][i] = dis;
+    if constexpr (std::is_same<Distance, Euclidean_distance>::value && Has_floating_point_coordinates<Point>::value) {
+      // Same distances, computed by blocks
+      using Coordinate = typename Has_floating_point_coordinates<Point>::Coordinate;
+      Blocked_euclidean_distance<Coordinate> blocked_distance(point_cloud);
+      // by tiles of tile_rows rows
+      const int tile_rows = 32;
+      std::vector<Coordinate> tile;
+      for (int first_row = 0; first_row < this->num_points; first_row += tile_rows) {
+        int last_row = (std::min)(first_row + tile_rows, this->num_points);
+        int row_size = this->num_points - first_row;
+        tile.resize((last_row - first_row) * row_size);
+        blocked_distance.distances(first_row, last_row, first_row, this->num_points, tile.data());
+        for (int i = first_row; i < last_row; i++) {
+          int state = 100 * (i + 1) / this->num_points;
+          if (verbose && state % 10 == 0) std::clog << "\r" << state << "%" << std::flush;
+          for (int j = i; j < this->num_points; j++) {
+            distances[i][j] = tile[(i - first_row) * row_size + j - first_row];
+            distances[j][i] = distances[i][j];
+          }
+        }
+      }
+    } else {
+      for (int i = 0; i < this->num_points; i++) {
+        int state = 100 * (i + 1) / this->num_points;
+        if (verbose && state % 10 == 0) std::clog << "\r" << state << "%" << std::flush;
+        for (int j = i; j < this->num_points; j++) {
+          double dis = ref_distance(point_cloud[i], point_cloud[j]);
+          distances[i][j] = dis;
+          distances[j][i] = dis;
+        }
       }
     }
     if (verbose) std::clog << std::endl;
@@ -16,6 +16,7 @@
 #include <limits>
 #include <string>
 #include <vector>
+#include <random>
 
 #include <gudhi/GIC.h>
 #include <gudhi/distance_functions.h>
@@ -79,3 +80,35 @@ BOOST_AUTO_TEST_CASE(check_voronoiGIC) {
   BOOST_CHECK((stree.num_simplices() - stree.num_vertices()) == 1);
   BOOST_CHECK(stree.dimension() == 1);
 }
+
+BOOST_AUTO_TEST_CASE(check_GIC_from_rips_with_blocked_distance) {
+  using Point = std::vector<double>;
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  std::vector<Point> points(300, Point(3));
+  for (auto& p : points)
+    for (auto& x : p) x = unif(gen);
+
+  auto create_complex = [&](auto distance) {
+    Gudhi::cover_complex::Cover_complex<Point> GIC;
+    GIC.set_type("GIC");
+    GIC.set_point_cloud_from_range(points);
+    GIC.set_color_from_coordinate();
+    GIC.set_function_from_coordinate(0);
+    // The pairwise distances are computed with Gudhi::Blocked_euclidean_distance for Gudhi::Euclidean_distance only
+    GIC.set_graph_from_rips(0.2, distance);
+    GIC.set_resolution_with_interval_number(5);
+    GIC.set_gain(0.3);
+    GIC.set_cover_from_function();
+    GIC.find_simplices();
+    Gudhi::Simplex_tree<> stree;
+    GIC.create_complex(stree);
+    return stree;
+  };
+  auto stree = create_complex(Gudhi::Euclidean_distance());
+  auto stree_generic = create_complex([](const Point& p1, const Point& p2) {
+    return Gudhi::Euclidean_distance()(p1, p2);
+  });
+  BOOST_CHECK(stree.num_vertices() > 0);
+  BOOST_CHECK(stree == stree_generic);
+}
@@ -0,0 +1,191 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <unordered_set>
+#include <unordered_map>
+#include <functional>  // for std::hash
+#include <cstddef>     // for std::size_t
+#include <cstdlib>  // for std::atoi, std::atof
+
+#include <gudhi/matrix.h>
+#include <gudhi/persistence_matrix_options.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+
+using Gudhi::persistence_matrix::Default_options;
+using Gudhi::persistence_matrix::Column_types;
+using Simplex_tree = Gudhi::Simplex_tree<>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Point = std::vector<double>;
+
+template <Column_types col_type>
+struct Compression_options : Default_options<col_type, true> {
+  static const bool has_column_compression = true;
+};
+
+// Same options, but the column hash specialized below is constant. So the column dictionary compares the full
+// column contents at every node, as it did before the hash values were cached and compared first.
+template <Column_types col_type>
+struct Content_comparison_options : Compression_options<col_type> {};
+
+template <Column_types col_type>
+using Content_comparison_matrix = Gudhi::persistence_matrix::Matrix<Content_comparison_options<col_type> >;
+
+struct Constant_hash {
+  template <class Column>
+  std::size_t operator()(const Column&) const { return 0; }
+};
+
+template <>
+struct std::hash<Gudhi::persistence_matrix::Intrusive_list_column<
+    Content_comparison_matrix<Column_types::INTRUSIVE_LIST> > > : Constant_hash {};
+template <>
+struct std::hash<Gudhi::persistence_matrix::Intrusive_set_column<
+    Content_comparison_matrix<Column_types::INTRUSIVE_SET> > > : Constant_hash {};
+template <>
+struct std::hash<Gudhi::persistence_matrix::Set_column<Content_comparison_matrix<Column_types::SET> > >
+    : Constant_hash {};
+template <>
+struct std::hash<Gudhi::persistence_matrix::Vector_column<Content_comparison_matrix<Column_types::VECTOR> > >
+    : Constant_hash {};
+template <>
+struct std::hash<Gudhi::persistence_matrix::Unordered_set_column<
+    Content_comparison_matrix<Column_types::UNORDERED_SET> > > : Constant_hash {};
+
+// Coboundary matrix of the Rips complex, that is, the anti-transposed boundary matrix: column `i` is the coboundary
+// of the simplex at position `n - 1 - i` in the filtration, and row indices are reversed in the same way.
+std::vector<std::vector<unsigned int> > build_coboundary_matrix(Simplex_tree& st) {
+  const unsigned int n = st.num_simplices();
+  unsigned int id = 0;
+  for (auto sh : st.filtration_simplex_range()) st.assign_key(sh, id++);
+
+  std::vector<std::vector<unsigned int> > columns(n);
+  for (auto sh : st.filtration_simplex_range()) {
+    std::vector<unsigned int>& col = columns[n - 1 - st.key(sh)];
+    for (auto csh : st.cofaces_simplex_range(sh, 1)) col.push_back(n - 1 - st.key(csh));
+    std::sort(col.begin(), col.end());
+  }
+  return columns;
+}
+
+// Base columns do not have pivots, and unordered columns have no last cell, so the maximal row index is searched.
+template <class Column>
+unsigned int get_max_row_index(const Column& col) {
+  unsigned int max = 0;
+  for (const auto& cell : col) max = std::max(max, cell.get_row_index());
+  return max;
+}
+
+struct Results {
+  unsigned int numberOfNonZeroColumns;
+  std::size_t numberOfStoredColumns;
+  unsigned int numberOfAdditions;
+  double insertionTime;  // ms
+  double reductionTime;  // ms
+};
+
+template <class Matrix>
+Results run(const std::vector<std::vector<unsigned int> >& columns) {
+  Results res{0, 0, 0, 0, 0};
+
+  auto start = std::chrono::steady_clock::now();
+  Matrix mat(columns.size());
+  for (const auto& col : columns) mat.insert_boundary(col);
+  auto stop = std::chrono::steady_clock::now();
+  res.insertionTime = std::chrono::duration<double, std::milli>(stop - start).count();
+
+  // get_column returns the representative of the column class, so distinct addresses are distinct columns
+  std::unordered_set<const void*> uniqueColumns;
+  for (unsigned int i = 0; i < columns.size(); ++i) {
+    if (!mat.is_zero_column(i)) {
+      ++res.numberOfNonZeroColumns;
+      uniqueColumns.insert(&mat.get_column(i));
+    }
+  }
+  res.numberOfStoredColumns = uniqueColumns.size();
+
+  // Standard left-to-right reduction of the coboundary matrix. Each addition removes the target column from the
+  // column dictionary and reinserts it, which is where the dictionary comparisons happen.
+  start = std::chrono::steady_clock::now();
+  std::unordered_map<unsigned int, unsigned int> pivotToColumn;
+  for (unsigned int i = 0; i < columns.size(); ++i) {
+    while (!mat.is_zero_column(i)) {
+      const auto& col = mat.get_column(i);
+      unsigned int pivot = get_max_row_index(col);
+      auto it = pivotToColumn.find(pivot);
+      if (it == pivotToColumn.end()) {
+        pivotToColumn.emplace(pivot, i);
+        break;
+      }
+      // an identical column was already reduced: the sum would be zero, but the compressed matrix does not add
+      // a column class to itself.
+      if (&mat.get_column(it->second) == &col) break;
+      mat.add_to(it->second, i);
+      ++res.numberOfAdditions;
+    }
+  }
+  stop = std::chrono::steady_clock::now();
+  res.reductionTime = std::chrono::duration<double, std::milli>(stop - start).count();
+
+  return res;
+}
+
+template <Column_types col_type>
+void benchmark(const std::vector<std::vector<unsigned int> >& columns, const char* name) {
+  Results hashFirst = run<Gudhi::persistence_matrix::Matrix<Compression_options<col_type> > >(columns);
+  Results contentOnly = run<Content_comparison_matrix<col_type> >(columns);
+
+  std::cout << name << ": " << hashFirst.numberOfNonZeroColumns << " non zero columns, "
+            << hashFirst.numberOfStoredColumns << " stored columns, compression ratio "
+            << (hashFirst.numberOfStoredColumns == 0
+                    ? 1.
+                    : static_cast<double>(hashFirst.numberOfNonZeroColumns) / hashFirst.numberOfStoredColumns)
+            << ", " << hashFirst.numberOfAdditions << " column additions during reduction\n";
+  std::cout << "    insertion: " << hashFirst.insertionTime << " ms (hash first) vs " << contentOnly.insertionTime
+            << " ms (content comparison)\n";
+  std::cout << "    reduction: " << hashFirst.reductionTime << " ms (hash first) vs " << contentOnly.reductionTime
+            << " ms (content comparison)\n";
+}
+
+// ./Matrix_benchmark_column_compression [n_pts [threshold [dim_max [seed]]]]
+int main(int argc, char* argv[]) {
+  const int numberOfPoints = (argc >= 2) ? std::atoi(argv[1]) : 200;
+  const double threshold = (argc >= 3) ? std::atof(argv[2]) : 0.3;
+  const int dimMax = (argc >= 4) ? std::atoi(argv[3]) : 2;
+  const int seed = (argc >= 5) ? std::atoi(argv[4]) : 0;
+
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  std::vector<Point> points;
+  points.reserve(numberOfPoints);
+  for (int i = 0; i < numberOfPoints; ++i) points.push_back({unif(gen), unif(gen), unif(gen)});
+
+  Simplex_tree st;
+  Rips_complex(points, threshold, Gudhi::Euclidean_distance()).create_complex(st, dimMax + 1);
+  std::cout << "Rips complex of " << numberOfPoints << " points, threshold " << threshold << ", dimension "
+            << st.dimension() << ": " << st.num_simplices() << " simplices\n";
+
+  auto columns = build_coboundary_matrix(st);
+
+  benchmark<Column_types::INTRUSIVE_LIST>(columns, "Intrusive_list_column");
+  benchmark<Column_types::INTRUSIVE_SET>(columns, "Intrusive_set_column");
+  benchmark<Column_types::SET>(columns, "Set_column");
+  benchmark<Column_types::VECTOR>(columns, "Vector_column");
+  benchmark<Column_types::UNORDERED_SET>(columns, "Unordered_set_column");
+
+  return 0;
+}
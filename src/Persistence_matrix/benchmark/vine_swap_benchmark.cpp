@@ -0,0 +1,135 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>  // for std::atoi, std::atof
+
+#include <gudhi/matrix.h>
+#include <gudhi/persistence_matrix_options.h>
+#include <gudhi/Simplex_tree.h>
+#include <gudhi/Rips_complex.h>
+#include <gudhi/distance_functions.h>
+
+using Gudhi::persistence_matrix::Default_options;
+using Gudhi::persistence_matrix::Column_types;
+using Gudhi::persistence_matrix::Column_indexation_types;
+using Simplex_tree = Gudhi::Simplex_tree<>;
+using Filtration_value = Simplex_tree::Filtration_value;
+using Rips_complex = Gudhi::rips_complex::Rips_complex<Filtration_value>;
+using Point = std::vector<double>;
+
+// Chain matrix maintaining its barcode through vine swaps and removals: the index dictionaries are accessed at
+// each of those operations.
+template <bool flat_maps>
+struct Vine_options : Default_options<Column_types::INTRUSIVE_LIST, true> {
+  static const bool is_of_boundary_type = false;
+  static const Column_indexation_types column_indexation_type = Column_indexation_types::POSITION;
+  static const bool has_column_pairings = true;
+  static const bool has_vine_update = true;
+  static const bool has_map_column_container = true;
+  static const bool has_removable_columns = true;
+  static const bool has_flat_index_maps = flat_maps;
+};
+
+struct Timings {
+  double insertion;  // ms
+  double swaps;      // ms
+  double removal;    // ms
+};
+
+// boundaries[i] is the boundary of the face inserted at position i, given by the positions of its facets.
+template <bool flat_maps>
+Timings run(const std::vector<std::vector<unsigned int> >& boundaries, const std::vector<int>& dimensions,
+            unsigned int numberOfSwaps, int seed) {
+  using Matrix = Gudhi::persistence_matrix::Matrix<Vine_options<flat_maps> >;
+  Timings res;
+
+  auto start = std::chrono::steady_clock::now();
+  Matrix mat(boundaries.size());
+  for (unsigned int i = 0; i < boundaries.size(); ++i) mat.insert_boundary(boundaries[i], dimensions[i]);
+  auto stop = std::chrono::steady_clock::now();
+  res.insertion = std::chrono::duration<double, std::milli>(stop - start).count();
+
+  // same random sequence of swaps for both runs
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<unsigned int> positions(0, boundaries.size() - 2);
+  std::vector<unsigned int> positionToFace(boundaries.size());
+  for (unsigned int i = 0; i < positionToFace.size(); ++i) positionToFace[i] = i;
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < numberOfSwaps; ++i) {
+    unsigned int pos = positions(gen);
+    const auto& boundary = boundaries[positionToFace[pos + 1]];
+    // the swap has to keep the filtration valid
+    if (std::binary_search(boundary.begin(), boundary.end(), positionToFace[pos])) continue;
+    mat.vine_swap(pos);
+    std::swap(positionToFace[pos], positionToFace[pos + 1]);
+  }
+  stop = std::chrono::steady_clock::now();
+  res.swaps = std::chrono::duration<double, std::milli>(stop - start).count();
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < boundaries.size(); ++i) mat.remove_last();
+  stop = std::chrono::steady_clock::now();
+  res.removal = std::chrono::duration<double, std::milli>(stop - start).count();
+
+  return res;
+}
+
+// ./Matrix_benchmark_vine_swap [n_pts [threshold [dim_max [number_of_swaps [seed]]]]]
+int main(int argc, char* argv[]) {
+  const int numberOfPoints = (argc >= 2) ? std::atoi(argv[1]) : 100;
+  const double threshold = (argc >= 3) ? std::atof(argv[2]) : 0.4;
+  const int dimMax = (argc >= 4) ? std::atoi(argv[3]) : 2;
+  const unsigned int numberOfSwaps = (argc >= 5) ? std::atoi(argv[4]) : 200000;
+  const int seed = (argc >= 6) ? std::atoi(argv[5]) : 0;
+
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  std::vector<Point> points;
+  points.reserve(numberOfPoints);
+  for (int i = 0; i < numberOfPoints; ++i) points.push_back({unif(gen), unif(gen), unif(gen)});
+
+  Simplex_tree st;
+  Rips_complex(points, threshold, Gudhi::Euclidean_distance()).create_complex(st, dimMax);
+  std::cout << "Rips complex of " << numberOfPoints << " points, threshold " << threshold << ", dimension "
+            << st.dimension() << ": " << st.num_simplices() << " simplices, " << numberOfSwaps
+            << " attempted vine swaps\n";
+
+  std::vector<std::vector<unsigned int> > boundaries;
+  std::vector<int> dimensions;
+  boundaries.reserve(st.num_simplices());
+  dimensions.reserve(st.num_simplices());
+  unsigned int id = 0;
+  for (auto sh : st.filtration_simplex_range()) {
+    st.assign_key(sh, id++);
+    std::vector<unsigned int> boundary;
+    for (auto b : st.boundary_simplex_range(sh)) boundary.push_back(st.key(b));
+    std::sort(boundary.begin(), boundary.end());
+    boundaries.push_back(std::move(boundary));
+    dimensions.push_back(st.dimension(sh));
+  }
+
+  Timings unordered = run<false>(boundaries, dimensions, numberOfSwaps, seed);
+  Timings flat = run<true>(boundaries, dimensions, numberOfSwaps, seed);
+
+  std::cout << "insertion: " << unordered.insertion << " ms (std::unordered_map) vs " << flat.insertion
+            << " ms (Flat_index_map)\n";
+  std::cout << "vine swaps: " << unordered.swaps << " ms (std::unordered_map) vs " << flat.swaps
+            << " ms (Flat_index_map)\n";
+  std::cout << "removals: " << unordered.removal << " ms (std::unordered_map) vs " << flat.removal
+            << " ms (Flat_index_map)\n";
+
+  return 0;
+}
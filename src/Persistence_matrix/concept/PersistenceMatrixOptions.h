@@ -99,6 +99,15 @@ struct PersistenceMatrixOptions
    * - @ref Matrix::remove_last "remove_last()" for @ref chainmatrix "chain matrices" if @ref has_vine_update is true.
    */
   static const bool has_map_column_container;
+  /**
+   * @brief Only used if @ref has_map_column_container is true or if bars can be removed from the barcode.
+   * If set to true, the dictionaries translating indices into other indices (and indices into bars) are
+   * @ref Gudhi::persistence_matrix::Flat_index_map "open-addressing hash maps" storing all their elements in one
+   * contiguous array, instead of std::unordered_map. Recommended when many vine swaps or removals are performed, as
+   * those dictionaries are then accessed at each operation. The columns themselves are still stored in an
+   * std::unordered_map, such that references to them remain valid. Optional: considered false if not defined.
+   */
+  static const bool has_flat_index_maps;
   /**
    * @brief If set to true, enables the methods @ref Matrix::remove_maximal_face and @ref Matrix::remove_last,
    * except for @ref basematrix "base matrices" when @ref has_column_compression is true.
@@ -12,10 +12,13 @@
 
 #include <gudhi/matrix.h>
 #include <gudhi/persistence_matrix_options.h>
+#include <gudhi/Persistence_matrix/simplex_tree_to_matrix.h>
 #include <gudhi/Simplex_tree.h>
 
 using Gudhi::persistence_matrix::Default_options;
 using Gudhi::persistence_matrix::Column_types;
+using Gudhi::persistence_matrix::build_matrix_from_simplex_tree;
+using Gudhi::persistence_matrix::insert_simplex_tree_boundaries;
 using Gudhi::Simplex_tree;
 
 struct RU_options : Default_options<Column_types::INTRUSIVE_LIST, true> 
@@ -115,29 +118,15 @@ int main() {
   build_simplex_tree(st); //could be any other way to build a simplex tree
   auto size = st.num_simplices();
 
-  //reserving space with `size` is not mandatory but recommended for better performances.
-  Base_matrix bm(size);
-  RU_matrix rum(size);
-  Chain_matrix cm(size);
+  //constructs the matrices with space reserved for all simplices and fills them with the boundary matrix computed from
+  //the simplex tree. The keys of the simplices are set to their position in the filtration, which is used as ID.
+  //The boundaries are not copied into a new container for each simplex.
+  auto bm = build_matrix_from_simplex_tree<Base_matrix>(st);
+  auto rum = build_matrix_from_simplex_tree<RU_matrix>(st);
 
-  //filling the matrices with the boundary matrix computed from the simplex tree
-  unsigned int id = 0;
-  for (auto sh : st.filtration_simplex_range()){
-    //identifying the simplex such that the IDs are strictly increasing in the order of filtration.
-    st.assign_key(sh, id++);
-
-    //creating boundary
-    std::vector<unsigned int> boundary;
-    for (auto b : st.boundary_simplex_range(sh)){
-      boundary.push_back(st.key(b));
-    }
-    std::sort(boundary.begin(), boundary.end());  //boundaries have to be ordered
-
-    //insertion in the matrices, the id is continuously increasing from 0 so no need to give it as an argument.
-    bm.insert_boundary(boundary);
-    rum.insert_boundary(boundary);
-    cm.insert_boundary(boundary);
-  }
+  //equivalent to the above, when the matrix has to be constructed separately
+  Chain_matrix cm(size);
+  insert_simplex_tree_boundaries(st, cm);
 
   //content of the matrices
   print_matrix(bm, size);
@@ -20,6 +20,8 @@
 #include <iostream>   //print() only
 #include <vector>
 #include <utility>    //std::swap, std::move & std::exchange
+#include <functional> //std::hash
+#include <cstddef>    //std::size_t
 
 #include <boost/intrusive/set.hpp>
 #include <boost/pending/disjoint_sets.hpp>
@@ -38,6 +40,8 @@ namespace persistence_matrix {
  * identical columns in the matrix are compressed together as the same column. For matrices with a lot of redundant
  * columns, this will save a lot of space. Also, any addition made onto a column will be performed at the same time
  * on all other identical columns, which is an advantage for the cohomology algorithm for example.
+ * To detect identical columns efficiently, the hash value of each stored column is cached and columns are compared
+ * by hash value first: the full, linear time comparison of two columns only occurs on a hash collision.
  * 
  * @tparam Master_matrix An instanciation of @ref Matrix from which all types and options are deduced.
  */
@@ -85,12 +89,13 @@ class Base_matrix_with_column_compression : protected Master_matrix::Matrix_row_
                 Row_container_type& rowContainer, Column_settings* colSettings)
         : Base(columnIndex, nonZeroRowIndices, dimension, rowContainer, colSettings) {}
     Column_type(const Column_type& column, Column_settings* colSettings = nullptr)
-        : Base(static_cast<const Base&>(column), colSettings) {}
+        : Base(static_cast<const Base&>(column), colSettings), hash_(column.hash_) {}
     template <class Row_container_type>
     Column_type(const Column_type& column, index columnIndex, Row_container_type& rowContainer,
                 Column_settings* colSettings = nullptr)
-        : Base(static_cast<const Base&>(column), columnIndex, rowContainer, colSettings) {}
-    Column_type(Column_type&& column) noexcept : Base(std::move(static_cast<Base&>(column))) {}
+        : Base(static_cast<const Base&>(column), columnIndex, rowContainer, colSettings), hash_(column.hash_) {}
+    Column_type(Column_type&& column) noexcept
+        : Base(std::move(static_cast<Base&>(column))), hash_(column.hash_) {}
 
     //TODO: is it possible to make this work?
     // template <class... U>
@@ -99,12 +104,39 @@ class Base_matrix_with_column_compression : protected Master_matrix::Matrix_row_
     index get_rep() const { return rep_; }
     void set_rep(const index& rep) { rep_ = rep; }
 
+    /**
+     * @brief Returns the hash value of the column content, as computed at the last call of @ref update_hash.
+     */
+    std::size_t get_hash() const { return hash_; }
+    /**
+     * @brief Recomputes the hash value of the column content. Has to be called every time the content changes
+     * and before the column is inserted in the column dictionary.
+     *
+     * The hash is recomputed from scratch instead of being updated during the additions: the recomputation is
+     * linear in the size of the column, so it is dominated by the addition which modified the column anyway, and
+     * it does not constrain the hash function to be compatible with the field operations of all column types.
+     */
+    void update_hash() { hash_ = std::hash<Base>()(static_cast<Base&>(*this)); }
+
     struct Hasher {
-      size_t operator()(const Column_type& c) const { return std::hash<Base>()(static_cast<Base>(c)); }
+      size_t operator()(const Column_type& c) const { return c.get_hash(); }
+    };
+
+    /**
+     * @brief Strict weak order used by the column dictionary: columns are first ordered by their cached hash values,
+     * so the comparison of the full contents only happens for columns with identical hash values, that is, for
+     * identical columns or on hash collisions.
+     */
+    struct Hash_first_less {
+      bool operator()(const Column_type& c1, const Column_type& c2) const {
+        if (c1.hash_ != c2.hash_) return c1.hash_ < c2.hash_;
+        return static_cast<const Base&>(c1) < static_cast<const Base&>(c2);
+      }
     };
 
    private:
-    index rep_; /**< Index in the union-find of the root of the set representing this column class. */
+    index rep_;             /**< Index in the union-find of the root of the set representing this column class. */
+    std::size_t hash_ = 0;  /**< Cached hash value of the column content. */
   };
 
   /**
@@ -334,9 +366,13 @@ class Base_matrix_with_column_compression : protected Master_matrix::Matrix_row_
   };
 
   using ra_opt = typename Master_matrix::Matrix_row_access_option;
-  using col_dict_type = boost::intrusive::set<Column_type, boost::intrusive::constant_time_size<false> >;
+  using col_dict_type = boost::intrusive::set<Column_type,
+                                              boost::intrusive::constant_time_size<false>,
+                                              boost::intrusive::compare<typename Column_type::Hash_first_less> >;
 
-  col_dict_type columnToRep_;                         /**< Map from a column to the index of its representative. */
+  col_dict_type columnToRep_;                         /**< Map from a column to the index of its representative.
+                                                           Ordered by hash value first, such that two columns are
+                                                           only fully compared if their hash values collide. */
   boost::disjoint_sets_with_storage<> columnClasses_; /**< Union-find structure,
                                                            where two columns in the same set are identical. */
   std::vector<Column_type*> repToColumn_;             /**< Map from the representative index to
@@ -649,6 +685,7 @@ inline void Base_matrix_with_column_compression<Master_matrix>::_insert_column(i
   }
 
   col.set_rep(columnIndex);
+  col.update_hash();
   auto res = columnToRep_.insert(col);
   if (res.first->get_rep() != columnIndex) {  //if true, then redundant column
     _insert_double_column(columnIndex, res.first);
@@ -159,17 +159,20 @@ inline void Base_swap<Master_matrix, Base_matrix>::swap_rows(id_index rowIndex1,
 
     if (it1 == indexToRow_.end() && it2 == indexToRow_.end()) return;
 
+    // iterators are not necessarily stable on insertion, so the erasure is done first
     if (it1 == indexToRow_.end()) {
-      indexToRow_.emplace(rowIndex1, it2->second);
-      rowToIndex_.at(it2->second) = rowIndex1;
-      indexToRow_.erase(it2->second);
+      auto row = it2->second;
+      indexToRow_.erase(it2);
+      indexToRow_.emplace(rowIndex1, row);
+      rowToIndex_.at(row) = rowIndex1;
       return;
     }
 
     if (it2 == indexToRow_.end()) {
-      indexToRow_.emplace(rowIndex2, it1->second);
-      rowToIndex_.at(it1->second) = rowIndex2;
+      auto row = it1->second;
       indexToRow_.erase(it1);
+      indexToRow_.emplace(rowIndex2, row);
+      rowToIndex_.at(row) = rowIndex2;
       return;
     }
 
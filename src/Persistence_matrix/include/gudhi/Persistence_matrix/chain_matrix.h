@@ -1245,7 +1245,7 @@ inline void Chain_matrix<Master_matrix>::_update_barcode(pos_index birth)
 {
   if constexpr (Master_matrix::Option_list::has_column_pairings) {
     if constexpr (Master_matrix::Option_list::has_removable_columns) {
-      auto& barIt = _indexToBar().at(birth);
+      auto barIt = _indexToBar().at(birth);  // copy, as the dictionary is not necessarily reference stable
       barIt->death = _nextPosition();
       _indexToBar().try_emplace(_nextPosition(), barIt);  // list so iterators are stable
     } else {
@@ -199,14 +199,23 @@ bool _multiply_source_and_add_to_column(const typename Column_type::Field_elemen
       []([[maybe_unused]] typename Column_type::Column_type::iterator& itTarget) {});
 }
 
+// Z2 cells do not store their value, as it is always 1.
+template <class Cell>
+unsigned int get_cell_hash_value(const Cell& cell) {
+  if constexpr (Cell::Master::Option_list::is_z2) {
+    return cell.get_row_index();
+  } else {
+    return cell.get_row_index() * static_cast<unsigned int>(cell.get_element());
+  }
+}
+
 // column has to be ordered (ie. not suited for unordered_map and heap) and contain the exact values
 // (ie. not suited for vector and heap). A same colonne but ordered differently will have another hash value.
 template <class Column_type>
 std::size_t hash_column(const Column_type& column) {
   std::size_t seed = 0;
   for (auto& cell : column) {
-    seed ^= std::hash<unsigned int>()(cell.get_row_index() * static_cast<unsigned int>(cell.get_element())) +
-            0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= std::hash<unsigned int>()(get_cell_hash_value(cell)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
   }
   return seed;
 }
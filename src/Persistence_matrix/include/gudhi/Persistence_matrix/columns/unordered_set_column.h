@@ -32,6 +32,7 @@
 #endif
 
 #include <gudhi/Persistence_matrix/allocators/cell_constructors.h>
+#include <gudhi/Persistence_matrix/columns/column_utilities.h>
 
 namespace Gudhi {
 namespace persistence_matrix {
@@ -1003,7 +1004,7 @@ struct std::hash<Gudhi::persistence_matrix::Unordered_set_column<Master_matrix>
     //can't use Gudhi::persistence_matrix::hash_column because unordered
     std::size_t seed = 0;
     for (const auto& cell : column) {
-      seed ^= std::hash<unsigned int>()(cell.get_row_index() * static_cast<unsigned int>(cell.get_element()));
+      seed ^= std::hash<unsigned int>()(Gudhi::persistence_matrix::get_cell_hash_value(cell));
     }
     return seed;
   }
@@ -137,7 +137,7 @@ class Vector_column : public Master_matrix::Row_access_option,
   Vector_column& multiply_source_and_add(const Cell_range& column, const Field_element_type& val);
   Vector_column& multiply_source_and_add(Vector_column& column, const Field_element_type& val);
 
-  std::size_t compute_hash_value();
+  std::size_t compute_hash_value() const;
 
   friend bool operator==(const Vector_column& c1, const Vector_column& c2) {
     if (&c1 == &c2) return true;
@@ -956,13 +956,12 @@ inline Vector_column<Master_matrix>& Vector_column<Master_matrix>::operator=(
 }
 
 template <class Master_matrix>
-inline std::size_t Vector_column<Master_matrix>::compute_hash_value()
+inline std::size_t Vector_column<Master_matrix>::compute_hash_value() const
 {
   std::size_t seed = 0;
   for (Cell* cell : column_) {
     if (erasedValues_.find(cell->get_row_index()) == erasedValues_.end()){
-      seed ^= std::hash<unsigned int>()(cell->get_row_index() * static_cast<unsigned int>(cell->get_element())) +
-              0x9e3779b9 + (seed << 6) + (seed >> 2);
+      seed ^= std::hash<unsigned int>()(get_cell_hash_value(*cell)) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     }
   }
   return seed;
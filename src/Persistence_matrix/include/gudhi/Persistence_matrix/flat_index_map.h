@@ -0,0 +1,288 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+/**
+ * @file flat_index_map.h
+ * @author agent
+ * @brief Contains the @ref Gudhi::persistence_matrix::Flat_index_map class.
+ */
+
+#ifndef PM_FLAT_INDEX_MAP_H
+#define PM_FLAT_INDEX_MAP_H
+
+#include <vector>
+#include <utility>    //std::pair, std::move, std::swap
+#include <cstddef>    //std::size_t
+#include <cstdint>    //std::uint64_t
+#include <iterator>   //std::forward_iterator_tag
+#include <stdexcept>  //std::out_of_range
+#include <type_traits>
+
+namespace Gudhi {
+namespace persistence_matrix {
+
+/**
+ * @ingroup persistence_matrix
+ *
+ * @brief Hash map from unsigned indices to values, with open addressing and linear probing. Used instead of
+ * std::unordered_map for the index dictionaries of the matrix when @ref PersistenceMatrixOptions::has_flat_index_maps
+ * is true. All pairs are stored in one contiguous array, so a lookup does not follow any pointer and the removal of
+ * an element does not free any memory.
+ *
+ * Only the part of the std::unordered_map interface used by the matrix is implemented. The differences are the
+ * following:
+ * - the key `static_cast<Key>(-1)` is reserved to mark empty slots, as -1 is never a valid index in the module,
+ * - references and iterators to the elements are invalidated by all insertions and removals,
+ * - @ref erase(iterator) does not return an iterator.
+ *
+ * @tparam Key Unsigned integer type of the keys.
+ * @tparam T Type of the values. Has to be default constructible.
+ */
+template <typename Key, typename T>
+class Flat_index_map
+{
+  static_assert(std::is_unsigned_v<Key>, "Keys have to be unsigned indices.");
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using size_type = std::size_t;
+
+  template <bool is_const>
+  class Slot_iterator
+  {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename Flat_index_map::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<is_const, const value_type*, value_type*>;
+    using reference = std::conditional_t<is_const, const value_type&, value_type&>;
+
+    Slot_iterator() : curr_(nullptr), end_(nullptr) {}
+    Slot_iterator(pointer curr, pointer end) : curr_(curr), end_(end) { _skip_empty_slots(); }
+    // conversion from iterator to const_iterator
+    template <bool other_is_const, class = std::enable_if_t<is_const && !other_is_const> >
+    Slot_iterator(const Slot_iterator<other_is_const>& other) : curr_(other.curr_), end_(other.end_) {}
+
+    reference operator*() const { return *curr_; }
+    pointer operator->() const { return curr_; }
+    Slot_iterator& operator++() {
+      ++curr_;
+      _skip_empty_slots();
+      return *this;
+    }
+    Slot_iterator operator++(int) {
+      Slot_iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    friend bool operator==(const Slot_iterator& it1, const Slot_iterator& it2) { return it1.curr_ == it2.curr_; }
+    friend bool operator!=(const Slot_iterator& it1, const Slot_iterator& it2) { return it1.curr_ != it2.curr_; }
+
+   private:
+    friend Flat_index_map;
+    template <bool>
+    friend class Slot_iterator;
+
+    pointer curr_;
+    pointer end_;
+
+    void _skip_empty_slots() {
+      while (curr_ != end_ && curr_->first == emptyKey_) ++curr_;
+    }
+  };
+
+  using iterator = Slot_iterator<false>;
+  using const_iterator = Slot_iterator<true>;
+
+  /**
+   * @brief Constructs an empty map.
+   */
+  Flat_index_map() : size_(0), shift_(sizeof(std::uint64_t) * 8) {}
+  /**
+   * @brief Constructs an empty map with enough space to store @p numberOfElements elements without rehashing.
+   *
+   * @param numberOfElements Number of elements to reserve space for.
+   */
+  explicit Flat_index_map(size_type numberOfElements) : Flat_index_map() { reserve(numberOfElements); }
+
+  iterator begin() noexcept { return iterator(slots_.data(), slots_.data() + slots_.size()); }
+  const_iterator begin() const noexcept { return const_iterator(slots_.data(), slots_.data() + slots_.size()); }
+  iterator end() noexcept { return iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size()); }
+  const_iterator end() const noexcept {
+    return const_iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size());
+  }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  /**
+   * @brief Returns an iterator to the element with key @p key, or @ref end if there is none.
+   */
+  iterator find(Key key) {
+    size_type pos = _find_position(key);
+    if (pos == slots_.size() || slots_[pos].first == emptyKey_) return end();
+    return iterator(slots_.data() + pos, slots_.data() + slots_.size());
+  }
+  const_iterator find(Key key) const {
+    size_type pos = _find_position(key);
+    if (pos == slots_.size() || slots_[pos].first == emptyKey_) return end();
+    return const_iterator(slots_.data() + pos, slots_.data() + slots_.size());
+  }
+  size_type count(Key key) const { return find(key) == end() ? 0 : 1; }
+
+  /**
+   * @brief Returns the value with key @p key. Throws std::out_of_range if there is none.
+   */
+  T& at(Key key) {
+    auto it = find(key);
+    if (it == end()) throw std::out_of_range("Flat_index_map::at: key not found.");
+    return it->second;
+  }
+  const T& at(Key key) const {
+    auto it = find(key);
+    if (it == end()) throw std::out_of_range("Flat_index_map::at: key not found.");
+    return it->second;
+  }
+  T& operator[](Key key) { return try_emplace(key).first->second; }
+
+  /**
+   * @brief Inserts the pair (@p key, `T(args...)`) if @p key is not already in the map.
+   *
+   * @return A pair with an iterator to the element with key @p key and a boolean indicating if the insertion
+   * took place.
+   */
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(Key key, Args&&... args) {
+    if (slots_.empty() || (size_ + 1) * 4 > slots_.size() * 3) _rehash((size_ + 1) * 2);
+    size_type pos = _find_position(key);
+    bool inserted = slots_[pos].first == emptyKey_;
+    if (inserted) {
+      slots_[pos].first = key;
+      slots_[pos].second = T(std::forward<Args>(args)...);
+      ++size_;
+    }
+    return {iterator(slots_.data() + pos, slots_.data() + slots_.size()), inserted};
+  }
+  template <class V>
+  std::pair<iterator, bool> emplace(Key key, V&& value) {
+    return try_emplace(key, std::forward<V>(value));
+  }
+
+  /**
+   * @brief Removes the element pointed by @p it. The following elements of the probe sequence are shifted back,
+   * so no tombstone is left behind.
+   */
+  void erase(const_iterator it) { _erase_position(it.curr_ - slots_.data()); }
+  void erase(iterator it) { _erase_position(it.curr_ - slots_.data()); }
+  /**
+   * @brief Removes the element with key @p key if it exists.
+   *
+   * @return The number of removed elements: 0 or 1.
+   */
+  size_type erase(Key key) {
+    size_type pos = _find_position(key);
+    if (pos == slots_.size() || slots_[pos].first == emptyKey_) return 0;
+    _erase_position(pos);
+    return 1;
+  }
+
+  /**
+   * @brief Removes all elements, but keeps the allocated memory.
+   */
+  void clear() {
+    for (auto& slot : slots_) {
+      slot.first = emptyKey_;
+      slot.second = T();
+    }
+    size_ = 0;
+  }
+
+  /**
+   * @brief Allocates enough memory to store @p numberOfElements elements without rehashing.
+   */
+  void reserve(size_type numberOfElements) {
+    if (numberOfElements * 4 > slots_.size() * 3) _rehash(numberOfElements);
+  }
+
+  void swap(Flat_index_map& other) {
+    slots_.swap(other.slots_);
+    std::swap(size_, other.size_);
+    std::swap(shift_, other.shift_);
+  }
+  friend void swap(Flat_index_map& map1, Flat_index_map& map2) { map1.swap(map2); }
+
+ private:
+  static constexpr Key emptyKey_ = static_cast<Key>(-1);
+
+  std::vector<value_type> slots_; /**< Slots of the table, the number of slots is always a power of 2. */
+  size_type size_;                /**< Number of non empty slots. */
+  unsigned int shift_;            /**< 64 - log2(number of slots), to take the highest bits of the hash. */
+
+  // Fibonacci hashing: spreads consecutive indices, which are the most common keys, over the whole table.
+  size_type _home_position(Key key) const {
+    return static_cast<size_type>((static_cast<std::uint64_t>(key) * 11400714819323198485ull) >> shift_);
+  }
+
+  // Position of the element with key `key` if present, otherwise of the empty slot ending its probe sequence.
+  // Returns the number of slots if the table is not allocated.
+  size_type _find_position(Key key) const {
+    if (slots_.empty()) return 0;
+    const size_type mask = slots_.size() - 1;
+    size_type pos = _home_position(key);
+    while (slots_[pos].first != key && slots_[pos].first != emptyKey_) pos = (pos + 1) & mask;
+    return pos;
+  }
+
+  void _erase_position(size_type pos) {
+    const size_type mask = slots_.size() - 1;
+    size_type next = (pos + 1) & mask;
+    while (slots_[next].first != emptyKey_) {
+      size_type home = _home_position(slots_[next].first);
+      // the element at `next` can be moved to `pos` if `pos` is between its home position and `next` (cyclically)
+      if (((next - home) & mask) >= ((next - pos) & mask)) {
+        slots_[pos] = std::move(slots_[next]);
+        pos = next;
+      }
+      next = (next + 1) & mask;
+    }
+    slots_[pos].first = emptyKey_;
+    slots_[pos].second = T();
+    --size_;
+  }
+
+  // Reallocates the table with enough slots for `numberOfElements` elements at a load factor of at most 3/4.
+  void _rehash(size_type numberOfElements) {
+    size_type numberOfSlots = 8;
+    unsigned int shift = sizeof(std::uint64_t) * 8 - 3;
+    while (numberOfSlots * 3 < numberOfElements * 4) {
+      numberOfSlots *= 2;
+      --shift;
+    }
+    if (numberOfSlots <= slots_.size()) return;
+
+    std::vector<value_type> oldSlots(numberOfSlots, value_type(emptyKey_, T()));
+    oldSlots.swap(slots_);
+    shift_ = shift;
+    const size_type mask = slots_.size() - 1;
+    for (auto& slot : oldSlots) {
+      if (slot.first == emptyKey_) continue;
+      size_type pos = _home_position(slot.first);
+      while (slots_[pos].first != emptyKey_) pos = (pos + 1) & mask;
+      slots_[pos] = std::move(slot);
+    }
+  }
+};
+
+}  // namespace persistence_matrix
+}  // namespace Gudhi
+
+#endif  // PM_FLAT_INDEX_MAP_H
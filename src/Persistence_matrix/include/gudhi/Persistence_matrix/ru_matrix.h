@@ -886,7 +886,7 @@ inline void RU_matrix<Master_matrix>::_update_barcode(pos_index birth, pos_index
       _barcode()[_indexToBar()[birth]].death = death;
       _indexToBar().push_back(_indexToBar()[birth]);
     } else {
-      auto& barIt = _indexToBar().at(birth);
+      auto barIt = _indexToBar().at(birth);  // copy, as the dictionary is not necessarily reference stable
       barIt->death = death;
       _indexToBar().try_emplace(death, barIt);  // list so iterators are stable
     }
@@ -0,0 +1,96 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+/**
+ * @file simplex_tree_to_matrix.h
+ * @author agent
+ * @brief Contains the @ref Gudhi::persistence_matrix::insert_simplex_tree_boundaries and
+ * @ref Gudhi::persistence_matrix::build_matrix_from_simplex_tree methods.
+ */
+
+#ifndef PM_SIMPLEX_TREE_TO_MATRIX_H
+#define PM_SIMPLEX_TREE_TO_MATRIX_H
+
+#include <vector>
+#include <algorithm>  //std::sort
+#include <cstddef>    //std::size_t
+
+namespace Gudhi {
+namespace persistence_matrix {
+
+/**
+ * @ingroup persistence_matrix
+ *
+ * @brief Inserts the boundaries of all simplices of the given simplex tree in the given matrix, in the order of the
+ * filtration. The key of each simplex is set to its position in the filtration, which is also its @ref IDIdx in
+ * the matrix.
+ *
+ * The boundaries are not copied into a new container for each simplex: the keys of the facets are written into a
+ * single buffer, whose capacity is reserved once for `st.dimension() + 1` keys, the maximal size of a boundary, and
+ * are sorted there before being given to the matrix. So no allocation happens outside of the matrix itself.
+ *
+ * Only available for \f$ \mathbb{Z}_2 \f$ coefficients, as the simplex tree does not provide oriented boundaries.
+ *
+ * @tparam SimplexTree A @ref Gudhi::Simplex_tree with keys stored.
+ * @tparam Matrix_type An instanciation of @ref Matrix with @ref PersistenceMatrixOptions::is_z2 set to true.
+ * @param st Simplex tree to insert. Its keys are overwritten.
+ * @param matrix Matrix to fill. Assumed to be empty.
+ */
+template <class SimplexTree, class Matrix_type>
+void insert_simplex_tree_boundaries(SimplexTree& st, Matrix_type& matrix)
+{
+  static_assert(Matrix_type::Option_list::is_z2, "Only Z2 coefficients are supported.");
+
+  using id_index = typename Matrix_type::id_index;
+
+  std::vector<id_index> boundary;
+  boundary.reserve(st.dimension() + 1);  // maximal size of a boundary
+
+  id_index id = 0;
+  for (auto sh : st.filtration_simplex_range()) {
+    // identifying the simplex such that the IDs are strictly increasing in the order of filtration.
+    st.assign_key(sh, id++);
+
+    boundary.clear();  // keeps the capacity
+    for (auto b : st.boundary_simplex_range(sh)) {
+      boundary.push_back(st.key(b));
+    }
+    std::sort(boundary.begin(), boundary.end());  // boundaries have to be ordered
+
+    matrix.insert_boundary(boundary, st.dimension(sh));
+  }
+}
+
+/**
+ * @ingroup persistence_matrix
+ *
+ * @brief Constructs a matrix with space reserved for the `st.num_simplices()` columns of the given simplex tree, and
+ * fills it with @ref insert_simplex_tree_boundaries.
+ * Only available if the matrix type can be constructed from a number of columns only. For the
+ * @ref chainmatrix "chain matrices" needing comparators, construct the matrix first and use
+ * @ref insert_simplex_tree_boundaries instead.
+ *
+ * @tparam Matrix_type An instanciation of @ref Matrix with @ref PersistenceMatrixOptions::is_z2 set to true.
+ * @tparam SimplexTree A @ref Gudhi::Simplex_tree with keys stored.
+ * @param st Simplex tree to insert. Its keys are overwritten.
+ * @return The filled matrix.
+ */
+template <class Matrix_type, class SimplexTree>
+Matrix_type build_matrix_from_simplex_tree(SimplexTree& st)
+{
+  Matrix_type matrix(st.num_simplices());
+  insert_simplex_tree_boundaries(st, matrix);
+  return matrix;
+}
+
+}  // namespace persistence_matrix
+}  // namespace Gudhi
+
+#endif  // PM_SIMPLEX_TREE_TO_MATRIX_H
@@ -30,6 +30,8 @@
 
 #include <gudhi/Fields/Z2_field_operators.h>
 
+#include <gudhi/Persistence_matrix/flat_index_map.h>
+
 #include <gudhi/Persistence_matrix/overlay_ididx_to_matidx.h>
 #include <gudhi/Persistence_matrix/overlay_posidx_to_matidx.h>
 
@@ -70,6 +72,16 @@ namespace Gudhi {
 /// Persistence matrix namespace.
 namespace persistence_matrix {
 
+// Value of PersistenceMatrixOptions::has_flat_index_maps, or false if the option structure was written before this
+// option existed and does not define it.
+template <class PersistenceMatrixOptions, class = void>
+struct Has_flat_index_maps : std::false_type {};
+
+template <class PersistenceMatrixOptions>
+struct Has_flat_index_maps<PersistenceMatrixOptions,
+                           std::void_t<decltype(PersistenceMatrixOptions::has_flat_index_maps)>>
+    : std::integral_constant<bool, PersistenceMatrixOptions::has_flat_index_maps> {};
+
 /**
  * @class Matrix persistence_matrix.h gudhi/persistence_matrix.h
  * @ingroup persistence_matrix
@@ -302,10 +314,22 @@ class Matrix {
                                 Dummy_matrix_row_access
                                >::type;
 
+  /**
+   * @brief Hash map used for the index dictionaries when @ref PersistenceMatrixOptions::has_map_column_container is
+   * true, and for the bar dictionaries when bars can be removed: @ref Flat_index_map if
+   * @ref PersistenceMatrixOptions::has_flat_index_maps is true, std::unordered_map otherwise (also when the option
+   * is not defined).
+   */
+  template <typename key_type, typename value_type>
+  using index_map_type = typename std::conditional<Has_flat_index_maps<PersistenceMatrixOptions>::value,
+                                                   Flat_index_map<key_type, value_type>,
+                                                   std::unordered_map<key_type, value_type>
+                                                  >::type;
+
   template <typename value_type>
   using dictionnary_type =
       typename std::conditional<PersistenceMatrixOptions::has_map_column_container,
-                                std::unordered_map<unsigned int, value_type>,
+                                index_map_type<unsigned int, value_type>,
                                 std::vector<value_type>
                                >::type;
 
@@ -452,10 +476,10 @@ class Matrix {
       typename std::conditional<hasFixedBarcode,
                                 typename std::conditional<PersistenceMatrixOptions::can_retrieve_representative_cycles,
                                   std::vector<index>,                   //RU
-                                  std::unordered_map<pos_index, index>  //boundary
+                                  index_map_type<pos_index, index>      //boundary
                                 >::type,
                                 typename std::conditional<PersistenceMatrixOptions::has_removable_columns,
-                                  std::unordered_map<pos_index, typename barcode_type::iterator>,
+                                  index_map_type<pos_index, typename barcode_type::iterator>,
                                   std::vector<index>
                                 >::type
                                >::type;
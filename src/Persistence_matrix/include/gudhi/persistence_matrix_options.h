@@ -88,6 +88,7 @@ struct Default_options
   static const bool has_column_and_row_swaps = false;
 
   static const bool has_map_column_container = false;
+  static const bool has_flat_index_maps = false;
   static const bool has_removable_columns = false;
 
   static const bool has_row_access = false;
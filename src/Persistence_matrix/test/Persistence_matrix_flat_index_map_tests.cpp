@@ -0,0 +1,100 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <map>
+#include <random>
+#include <stdexcept>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "persistence_matrix_flat_index_map"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Persistence_matrix/flat_index_map.h>
+
+using Gudhi::persistence_matrix::Flat_index_map;
+
+template <class Map>
+void test_same_content(const Map& map, const std::map<unsigned int, int>& witness) {
+  BOOST_CHECK_EQUAL(map.size(), witness.size());
+  BOOST_CHECK_EQUAL(map.empty(), witness.empty());
+  std::map<unsigned int, int> content;
+  for (const auto& p : map) content.emplace(p.first, p.second);
+  BOOST_CHECK(content == witness);
+  for (const auto& p : witness) {
+    auto it = map.find(p.first);
+    BOOST_REQUIRE(it != map.end());
+    BOOST_CHECK_EQUAL(it->second, p.second);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Flat_index_map_basic_operations) {
+  Flat_index_map<unsigned int, int> map;
+  BOOST_CHECK(map.empty());
+  BOOST_CHECK(map.find(3) == map.end());
+  BOOST_CHECK(map.begin() == map.end());
+  BOOST_CHECK_THROW(map.at(3), std::out_of_range);
+
+  BOOST_CHECK(map.emplace(3, 30).second);
+  BOOST_CHECK(!map.emplace(3, 31).second);
+  BOOST_CHECK(map.try_emplace(4, 40).second);
+  map[5] = 50;
+  map[3] += 1;
+  BOOST_CHECK_EQUAL(map.at(3), 31);
+  BOOST_CHECK_EQUAL(map.at(4), 40);
+  BOOST_CHECK_EQUAL(map.at(5), 50);
+  BOOST_CHECK_EQUAL(map.count(5), 1u);
+  BOOST_CHECK_EQUAL(map.count(6), 0u);
+  BOOST_CHECK_EQUAL(map.size(), 3u);
+
+  BOOST_CHECK_EQUAL(map.erase(4), 1u);
+  BOOST_CHECK_EQUAL(map.erase(4), 0u);
+  map.erase(map.find(3));
+  test_same_content(map, {{5, 50}});
+
+  Flat_index_map<unsigned int, int> copy(map);
+  map.clear();
+  BOOST_CHECK(map.empty());
+  test_same_content(copy, {{5, 50}});
+  map.swap(copy);
+  test_same_content(map, {{5, 50}});
+  test_same_content(copy, {});
+}
+
+BOOST_AUTO_TEST_CASE(Flat_index_map_random_operations) {
+  Flat_index_map<unsigned int, int> map(10);
+  std::map<unsigned int, int> witness;
+  std::mt19937 gen(0);
+  // small key range, such that long probe sequences with many removals in between are created
+  std::uniform_int_distribution<unsigned int> keys(0, 300);
+  std::uniform_int_distribution<int> operations(0, 2);
+
+  for (int i = 0; i < 20000; ++i) {
+    unsigned int key = keys(gen);
+    switch (operations(gen)) {
+      case 0:
+        map[key] = i;
+        witness[key] = i;
+        break;
+      case 1:
+        BOOST_CHECK_EQUAL(map.erase(key), witness.erase(key));
+        break;
+      default:
+        auto it = map.find(key);
+        BOOST_CHECK_EQUAL(it == map.end(), witness.find(key) == witness.end());
+        if (it != map.end()) {
+          map.erase(it);
+          witness.erase(key);
+        }
+        break;
+    }
+    if (i % 1000 == 0) test_same_content(map, witness);
+  }
+  test_same_content(map, witness);
+}
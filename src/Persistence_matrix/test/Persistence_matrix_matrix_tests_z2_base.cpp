@@ -47,3 +47,7 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Base_matrix_z2_operation, Matrix, full_matrices) {
 }
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(Base_matrix_z2_swaps, Matrix, swap_matrices) { test_base_swaps<Matrix>(); }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Base_matrix_z2_swaps_with_missing_row, Matrix, swap_matrices) {
+  test_base_swaps_with_missing_row<Matrix>();
+}
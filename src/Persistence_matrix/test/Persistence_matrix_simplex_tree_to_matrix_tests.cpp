@@ -0,0 +1,68 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "persistence_matrix"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/matrix.h>
+#include <gudhi/persistence_matrix_options.h>
+#include <gudhi/Persistence_matrix/simplex_tree_to_matrix.h>
+#include <gudhi/Simplex_tree.h>
+
+using Gudhi::persistence_matrix::Column_types;
+using Gudhi::persistence_matrix::Default_options;
+
+struct RU_options : Default_options<Column_types::INTRUSIVE_LIST, true> {
+  static const bool has_column_pairings = true;
+};
+
+using RU_matrix = Gudhi::persistence_matrix::Matrix<RU_options>;
+using Simplex_tree = Gudhi::Simplex_tree<>;
+
+BOOST_AUTO_TEST_CASE(simplex_tree_to_matrix) {
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  Simplex_tree st;
+  for (int i = 0; i < 15; ++i) st.insert_simplex({i}, 0.);
+  for (int i = 0; i < 15; ++i)
+    for (int j = i + 1; j < 15; ++j) st.insert_simplex({i, j}, unif(gen));
+  st.expansion(3);
+
+  // reference: boundaries copied one by one
+  RU_matrix ref(st.num_simplices());
+  unsigned int id = 0;
+  for (auto sh : st.filtration_simplex_range()) {
+    st.assign_key(sh, id++);
+    std::vector<unsigned int> boundary;
+    for (auto b : st.boundary_simplex_range(sh)) boundary.push_back(st.key(b));
+    std::sort(boundary.begin(), boundary.end());
+    ref.insert_boundary(boundary);
+  }
+
+  auto mat = Gudhi::persistence_matrix::build_matrix_from_simplex_tree<RU_matrix>(st);
+  BOOST_CHECK_EQUAL(mat.get_number_of_columns(), st.num_simplices());
+
+  id = 0;
+  for (auto sh : st.filtration_simplex_range()) BOOST_CHECK_EQUAL(st.key(sh), id++);
+
+  auto get_bars = [](RU_matrix& m) {
+    std::vector<std::tuple<int, unsigned int, unsigned int> > bars;
+    for (const auto& bar : m.get_current_barcode()) bars.emplace_back(bar.dim, bar.birth, bar.death);
+    std::sort(bars.begin(), bars.end());
+    return bars;
+  };
+  BOOST_CHECK(get_bars(mat) == get_bars(ref));
+}
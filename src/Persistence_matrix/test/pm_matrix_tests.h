@@ -1489,6 +1489,31 @@ void test_base_swaps() {
   test_content_equality(columns, m);
 }
 
+// swaps with a row index which does not appear in the matrix, after the rows were already permuted once.
+template <class Matrix>
+void test_base_swaps_with_missing_row() {
+  Matrix m(2, 5);
+  if constexpr (Matrix::Option_list::is_z2) {
+    m.insert_boundary({0});
+    m.insert_boundary({1});
+  } else {
+    m.insert_boundary({{0, 1}});
+    m.insert_boundary({{1, 1}});
+  }
+
+  m.swap_rows(0, 1);
+  BOOST_CHECK(m.is_zero_cell(0, 0));
+  BOOST_CHECK(!m.is_zero_cell(0, 1));
+  BOOST_CHECK(!m.is_zero_cell(1, 0));
+  BOOST_CHECK(m.is_zero_cell(1, 1));
+
+  m.swap_rows(5, 1);  // row 5 does not exist, row 1 is now the real row 0
+  BOOST_CHECK(!m.is_zero_cell(0, 5));
+  BOOST_CHECK(m.is_zero_cell(0, 0));
+  BOOST_CHECK(!m.is_zero_cell(1, 0));
+  BOOST_CHECK(m.is_zero_cell(1, 5));
+}
+
 // assumes matrix was build with `build_longer_boundary_matrix` and was given the right comparision methods for
 // non-barcode
 template <class Matrix>
@@ -21,6 +21,12 @@ using Gudhi::persistence_matrix::Matrix;
 
 using Zp = Gudhi::persistence_fields::Zp_field_operators<>;
 
+#ifdef PM_TEST_FLAT_MAP
+constexpr bool flat_index_maps = true;
+#else
+constexpr bool flat_index_maps = false;
+#endif
+
 template <bool is_z2_only, Column_types col_type, bool rem_col, bool swaps>
 struct Base_options {
   using Field_coeff_operators = Zp;
@@ -45,6 +51,7 @@ struct Base_options {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_column_and_row_swaps = swaps;
 };
 
@@ -72,6 +79,7 @@ struct Base_options_with_row_access {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_column_and_row_swaps = swaps;
 };
 
@@ -91,6 +99,7 @@ struct Column_compression_options {
   static const bool can_retrieve_representative_cycles = false;
   static const bool is_of_boundary_type = true;
   static const bool has_map_column_container = false;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_column_and_row_swaps = false;
   static const bool has_removable_columns = false;
 
@@ -117,6 +126,7 @@ struct Column_compression_options_with_row_access {
   static const bool can_retrieve_representative_cycles = false;
   static const bool is_of_boundary_type = true;
   static const bool has_map_column_container = false;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_column_and_row_swaps = false;
   static const bool has_removable_columns = false;
 
@@ -152,6 +162,7 @@ struct Boundary_options {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_column_and_row_swaps = swaps;
 };
 
@@ -180,6 +191,7 @@ struct Boundary_options_with_row_access {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_column_and_row_swaps = swaps;
 };
 
@@ -209,6 +221,7 @@ struct RU_vine_options {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
   static const bool has_column_pairings = barcode;
 };
@@ -239,6 +252,7 @@ struct RU_rep_options {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
   static const bool has_column_pairings = barcode;
 };
@@ -270,6 +284,7 @@ struct RU_vine_options_with_row_access {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
   static const bool has_column_pairings = barcode;
 };
@@ -301,6 +316,7 @@ struct RU_rep_options_with_row_access {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
   static const bool has_column_pairings = barcode;
 };
@@ -333,6 +349,7 @@ struct Chain_barcode_options {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
 };
 
@@ -363,6 +380,7 @@ struct Chain_vine_options {
   static const bool has_removable_columns = rem_col;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
 };
 
@@ -393,6 +411,7 @@ struct Chain_rep_options {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
 };
 
@@ -424,6 +443,7 @@ struct Chain_barcode_options_with_row_access {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
 };
 
@@ -455,6 +475,7 @@ struct Chain_vine_options_with_row_access {
   static const bool has_removable_columns = rem_col;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
 };
 
@@ -486,6 +507,7 @@ struct Chain_rep_options_with_row_access {
   static const bool has_removable_columns = true;
 
   static const bool has_map_column_container = rem_col;
+  static const bool has_flat_index_maps = flat_index_maps;
   static const bool has_matrix_maximal_dimension_access = dim;
 };
 
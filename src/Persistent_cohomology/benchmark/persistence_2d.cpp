@@ -61,11 +61,15 @@ int main() {
 #endif
 
   clock.begin();
-  std::vector<std::pair<double, double>> res2; res2.reserve(data.size() / 2);
-  auto out = [&res2](double b, double d) { if (b < d) res2.emplace_back(b, d); };
-  double global_min = Gudhi::cubical_complex::persistence_on_rectangle_from_top_cells(data.data(), sizes[1], sizes[0], out, out);
-  res2.emplace_back(global_min, std::numeric_limits<double>::infinity());
+  // One diagram per dimension, to compare with the tiled code
+  std::vector<std::pair<double, double>> res2_0, res2_1; res2_0.reserve(data.size() / 4); res2_1.reserve(data.size() / 4);
+  auto out0 = [&res2_0](double b, double d) { if (b < d) res2_0.emplace_back(b, d); };
+  auto out1 = [&res2_1](double b, double d) { if (b < d) res2_1.emplace_back(b, d); };
+  double global_min = Gudhi::cubical_complex::persistence_on_rectangle_from_top_cells(data.data(), sizes[1], sizes[0], out0, out1);
+  res2_0.emplace_back(global_min, std::numeric_limits<double>::infinity());
   std::clog << "Total new code: " << clock << std::endl;
+  std::vector<std::pair<double, double>> res2(res2_0);
+  res2.insert(res2.end(), res2_1.begin(), res2_1.end());
 
   clock.begin();
   std::vector<std::pair<double, double>> res3; res3.reserve(data.size() / 2);
@@ -74,6 +78,15 @@ int main() {
   res3.emplace_back(data[gm], std::numeric_limits<double>::infinity());
   std::clog << "Total new code with index: " << clock << std::endl;
 
+  clock.begin();
+  std::vector<std::pair<double, double>> res4_0, res4_1; res4_0.reserve(data.size() / 4); res4_1.reserve(data.size() / 4);
+  auto outt0 = [&res4_0](double b, double d) { if (b < d) res4_0.emplace_back(b, d); };
+  auto outt1 = [&res4_1](double b, double d) { if (b < d) res4_1.emplace_back(b, d); };
+  // A small memory budget, to have many bands
+  double gmt = Gudhi::cubical_complex::persistence_on_rectangle_from_top_cells_tiled(data.data(), sizes[1], sizes[0], outt0, outt1, 1 << 20);
+  res4_0.emplace_back(gmt, std::numeric_limits<double>::infinity());
+  std::clog << "Total tiled code: " << clock << std::endl;
+
 #ifndef ONLY_2D
   std::sort(res1.begin(), res1.end());
   std::sort(res2.begin(), res2.end());
@@ -87,6 +100,18 @@ int main() {
     std::exit(-3);
   }
 #endif
+  std::sort(res2_0.begin(), res2_0.end());
+  std::sort(res2_1.begin(), res2_1.end());
+  std::sort(res4_0.begin(), res4_0.end());
+  std::sort(res4_1.begin(), res4_1.end());
+  if(res2_0 != res4_0) {
+    std::cerr << "Bug 4 in dimension 0!\n";
+    std::exit(-4);
+  }
+  if(res2_1 != res4_1) {
+    std::cerr << "Bug 4 in dimension 1!\n";
+    std::exit(-4);
+  }
 
   return 0;
 }
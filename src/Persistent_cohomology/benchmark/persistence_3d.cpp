@@ -0,0 +1,101 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/Clock.h>
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Persistence_on_cube.h>
+
+#include <vector>
+#include <array>
+#include <cstdlib>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+
+// Set to true to test on a simple example with no finite interval.
+const bool monotone = false;
+
+int main() {
+  std::vector<unsigned> sizes {60, 59, 58};
+  std::vector<double> data(sizes[0] * sizes[1] * sizes[2]);
+  if (monotone) {
+    std::iota(data.begin(), data.end(), std::size_t(0));
+  } else {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    // Few distinct values, to check the ties
+    std::uniform_int_distribution<int> dist(0, 20);
+    std::generate(data.begin(), data.end(), std::bind(dist, gen));
+  }
+
+  Gudhi::Clock clock;
+  std::array<std::vector<std::pair<double, double>>, 3> res1;
+#ifndef ONLY_3D
+  Gudhi::Clock clock_old;
+  typedef Gudhi::cubical_complex::Bitmap_cubical_complex_base<double> Base;
+  typedef Gudhi::cubical_complex::Bitmap_cubical_complex<Base> Cubical;
+  Cubical complex_from_top_cells(sizes, data, true);
+  std::clog << "Construction from top cells: " << clock;
+
+  clock.begin();
+  using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
+  Gudhi::persistent_cohomology::Persistent_cohomology<Cubical, Field_Zp> pers(complex_from_top_cells);
+  pers.init_coefficients(2);
+  pers.compute_persistent_cohomology();
+  std::clog << "Compute persistent homology: " << clock;
+  for (auto p: pers.get_persistent_pairs()){
+    auto birth = std::get<0>(p), death = std::get<1>(p);
+    res1[complex_from_top_cells.dimension(birth)].emplace_back(complex_from_top_cells.filtration(birth),
+                                                              complex_from_top_cells.filtration(death));
+  }
+  std::clog << "Total old code: " << clock_old << std::endl;
+#endif
+
+  clock.begin();
+  std::array<std::vector<std::pair<double, double>>, 3> res2;
+  auto out = [&res2](int dim) { return [&res2, dim](double b, double d) { if (b < d) res2[dim].emplace_back(b, d); }; };
+  double global_min = Gudhi::cubical_complex::persistence_on_cube_from_top_cells(
+      data.data(), sizes[2], sizes[1], sizes[0], out(0), out(1), out(2));
+  res2[0].emplace_back(global_min, std::numeric_limits<double>::infinity());
+  std::clog << "Total new code: " << clock << std::endl;
+
+  clock.begin();
+  std::array<std::vector<std::pair<double, double>>, 3> res3;
+  auto outi = [&res3, &data](int dim) {
+    return [&res3, &data, dim](std::size_t b, std::size_t d) {
+      if (data[b] < data[d]) res3[dim].emplace_back(data[b], data[d]);
+    };
+  };
+  std::size_t gm = Gudhi::cubical_complex::persistence_on_cube_from_top_cells<true>(
+      data.data(), std::size_t(sizes[2]), std::size_t(sizes[1]), std::size_t(sizes[0]), outi(0), outi(1), outi(2));
+  res3[0].emplace_back(data[gm], std::numeric_limits<double>::infinity());
+  std::clog << "Total new code with index: " << clock << std::endl;
+
+#ifndef ONLY_3D
+  for (int dim = 0; dim < 3; ++dim) {
+    std::sort(res1[dim].begin(), res1[dim].end());
+    std::sort(res2[dim].begin(), res2[dim].end());
+    std::sort(res3[dim].begin(), res3[dim].end());
+    if(res1[dim] != res2[dim]) {
+      std::cerr << "Bug 2 in dimension " << dim << "!\n";
+      std::exit(-2);
+    }
+    if(res1[dim] != res3[dim]) {
+      std::cerr << "Bug 3 in dimension " << dim << "!\n";
+      std::exit(-3);
+    }
+  }
+#endif
+
+  return 0;
+}
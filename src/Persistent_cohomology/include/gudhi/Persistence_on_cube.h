@@ -0,0 +1,360 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef PERSISTENCE_ON_CUBE_H
+#define PERSISTENCE_ON_CUBE_H
+
+#include <gudhi/Debug_utils.h>
+#ifdef GUDHI_DETAILED_TIMES
+ #include <gudhi/Clock.h>
+#endif
+
+#ifdef GUDHI_USE_TBB
+ #include <tbb/parallel_sort.h>
+#endif
+
+#include <vector>
+#include <array>
+#include <numeric>  // for std::iota
+#include <algorithm>
+#include <iterator>  // for std::back_inserter
+#include <utility>  // for std::pair
+#include <stdexcept>
+#include <cstddef>
+
+namespace Gudhi::cubical_complex {
+
+// Same idea as Persistence_on_rectangle, for a 3d cubical complex built from top-dimensional cells (voxels).
+// Each cell has the filtration value of its smallest adjacent voxel in the total order (value, index) of the voxels:
+// it enters the filtration with this voxel, its "owner". The cells are ordered by the rank of their owner, then by
+// dimension, then by id, which is a valid filtration order.
+// * H0: union-find on the vertices, with the edges in the order of their owners (primal).
+// * H2: union-find on the voxels and a single exterior cell, with the faces in the reverse order (dual).
+// * H1: the edges that do not merge 2 components in the primal are positive, and the faces that do not merge 2
+//   components in the dual are negative. The complex is contractible, so they are paired, by the reduction of the
+//   boundary matrix restricted to these rows and columns (the rows of the negative edges can be removed without
+//   changing the pairing, and the columns of the positive faces reduce to 0).
+// Nothing is stored per edge or per face, except the positive edges and the negative faces.
+// The coordinates are in the order (x, y, z) where x is the fastest varying one in the input.
+template <class Filtration_value, class Index = std::size_t, bool output_index = false>
+struct Persistence_on_cube {
+  struct Critical_cell {
+    Index id;        // 3 * (index of its first vertex) + direction
+    Index top_cell;  // its owner
+  };
+
+  Filtration_value const* input_p;
+  Filtration_value input(Index i) const { return input_p[i]; }
+  auto out_value(Index i) const {
+    if constexpr (output_index)
+      return i;
+    else
+      return input(i);
+  }
+
+  // Number of voxels in each direction, and strides of the voxels and of the vertices
+  std::array<Index, 3> n_, sv_, sw_;
+  Index input_size, num_vertices;
+
+  // Voxels sorted by (value, index), and the inverse permutation
+  std::vector<Index> order_;
+  std::vector<Index> rank_;
+
+  // Parents of the vertices during the primal pass, then of the voxels (and the exterior) during the dual pass.
+  // As in Persistence_on_rectangle, the representative is the oldest element.
+  std::vector<Index> ds_parent_;
+  Index ds_find_set(Index v) {
+    // Path halving
+    Index parent = ds_parent_[v];
+    Index grandparent = ds_parent_[parent];
+    while (parent != grandparent) {
+      ds_parent_[v] = grandparent;
+      v = grandparent;
+      parent = ds_parent_[v];
+      grandparent = ds_parent_[parent];
+    }
+    return parent;
+  }
+
+  std::vector<Critical_cell> positive_edges;
+  std::vector<Critical_cell> negative_faces;
+
+  void init(const Filtration_value* input_, Index n_layers, Index n_rows, Index n_cols) {
+    input_p = input_;
+    n_ = {n_cols, n_rows, n_layers};
+    sv_ = {1, n_cols, n_cols * n_rows};
+    sw_ = {1, n_cols + 1, (n_cols + 1) * (n_rows + 1)};
+    input_size = n_cols * n_rows * n_layers;
+    num_vertices = sw_[2] * (n_layers + 1);
+    order_.resize(input_size);
+    std::iota(order_.begin(), order_.end(), Index(0));
+  }
+
+  void sort_top_cells() {
+    auto cmp = [this](Index a, Index b) {
+      Filtration_value fa = input(a), fb = input(b);
+      if (fa < fb) return true;
+      if (fb < fa) return false;
+      return a < b;
+    };
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_sort(order_.begin(), order_.end(), cmp);
+#else
+    std::sort(order_.begin(), order_.end(), cmp);
+#endif
+    rank_.resize(input_size);
+    for (Index r = 0; r < input_size; ++r) rank_[order_[r]] = r;
+  }
+
+  // Insertion sort of the first n elements of a small array, faster than std::sort for at most 12 elements (and
+  // std::sort on a prefix of a std::array makes GCC 12 warn wrongly with -Warray-bounds).
+  template <class T, std::size_t N>
+  static void sort_prefix(std::array<T, N>& a, int n) {
+    for (int i = 1; i < n; ++i) {
+      T x = a[i];
+      int j = i;
+      for (; j > 0 && x < a[j - 1]; --j) a[j] = a[j - 1];
+      a[j] = x;
+    }
+  }
+
+  void coordinates(Index v, std::array<Index, 3> const& strides, std::array<Index, 3>& c) const {
+    c[2] = v / strides[2];
+    v -= c[2] * strides[2];
+    c[1] = v / strides[1];
+    c[0] = v - c[1] * strides[1];
+  }
+
+  // Calls f(v) for each voxel v adjacent to the cell of the voxel of coordinates c that spans the directions of the
+  // bitmask `span`, and whose first vertex is shifted by 1 from the one of c in the directions of the bitmask `shift`.
+  // This also works for a vertex of coordinates c, with span = shift = 0.
+  template <class F>
+  void for_each_adjacent_top_cell(std::array<Index, 3> const& c, unsigned span, unsigned shift, F&& f) const {
+    std::array<Index, 3> lo, hi;
+    for (int k = 0; k < 3; ++k) {
+      if (span >> k & 1) {
+        lo[k] = hi[k] = c[k];
+      } else {
+        Index p = c[k] + (shift >> k & 1);
+        lo[k] = p == 0 ? 0 : p - 1;
+        hi[k] = p == n_[k] ? p - 1 : p;
+      }
+    }
+    for (Index z = lo[2]; z <= hi[2]; ++z)
+      for (Index y = lo[1]; y <= hi[1]; ++y)
+        for (Index x = lo[0]; x <= hi[0]; ++x) f(x * sv_[0] + y * sv_[1] + z * sv_[2]);
+  }
+
+  bool is_owner(Index v, std::array<Index, 3> const& c, unsigned span, unsigned shift) const {
+    bool owner = true;
+    for_each_adjacent_top_cell(c, span, shift, [&](Index w) { if (rank_[w] < rank_[v]) owner = false; });
+    return owner;
+  }
+
+  Index cell_id(std::array<Index, 3> const& c, unsigned shift, int direction) const {
+    Index first_vertex = 0;
+    for (int k = 0; k < 3; ++k) first_vertex += (c[k] + (shift >> k & 1)) * sw_[k];
+    return 3 * first_vertex + direction;
+  }
+
+  // Rank of the owner of a vertex
+  Index vertex_rank(Index w) const {
+    std::array<Index, 3> c;
+    coordinates(w, sw_, c);
+    Index r = input_size;
+    for_each_adjacent_top_cell(c, 0, 0, [&](Index v) { r = std::min(r, rank_[v]); });
+    return r;
+  }
+
+  template <class Out>
+  void primal(Out&& out) {
+    ds_parent_.resize(num_vertices);
+    std::iota(ds_parent_.begin(), ds_parent_.end(), Index(0));
+    std::array<Index, 3> c;
+    std::array<Index, 12> edges;
+    for (Index v : order_) {
+      coordinates(v, sv_, c);
+      int num_edges = 0;
+      for (int d = 0; d < 3; ++d) {
+        unsigned k1 = (d + 1) % 3, k2 = (d + 2) % 3;
+        for (unsigned s = 0; s < 4; ++s) {
+          unsigned shift = (s & 1) << k1 | (s >> 1) << k2;
+          if (is_owner(v, c, 1u << d, shift)) edges[num_edges++] = cell_id(c, shift, d);
+        }
+      }
+      sort_prefix(edges, num_edges);
+      for (int j = 0; j < num_edges; ++j) {
+        Index w = edges[j] / 3;
+        Index a = ds_find_set(w);
+        Index b = ds_find_set(w + sw_[edges[j] % 3]);
+        if (a == b) {
+          positive_edges.push_back({edges[j], v});
+          continue;
+        }
+        Index ra = vertex_rank(a), rb = vertex_rank(b);
+        if (rb < ra || (rb == ra && b < a)) {
+          std::swap(a, b);
+          std::swap(ra, rb);
+        }
+        ds_parent_[b] = a;
+        // The pairs of a vertex and an edge of the same voxel have persistence 0
+        if (order_[rb] != v) out(out_value(order_[rb]), out_value(v));
+      }
+    }
+  }
+
+  // In the dual, voxels behave like vertices, and faces like edges. The boundary faces connect their voxel to a single
+  // exterior cell, the oldest one.
+  template <class Out>
+  void dual(Out&& out) {
+    const Index exterior = input_size;
+    ds_parent_.resize(input_size + 1);
+    std::iota(ds_parent_.begin(), ds_parent_.end(), Index(0));
+    std::array<Index, 3> c;
+    // Face id and neighbor voxel
+    std::array<std::pair<Index, Index>, 6> faces;
+    for (Index r = input_size; r-- > 0;) {
+      Index v = order_[r];
+      coordinates(v, sv_, c);
+      int num_faces = 0;
+      for (int d = 0; d < 3; ++d) {
+        unsigned span = 7u & ~(1u << d);
+        for (unsigned s = 0; s < 2; ++s) {
+          unsigned shift = s << d;
+          if (!is_owner(v, c, span, shift)) continue;
+          Index neighbor;
+          if (s == 0)
+            neighbor = c[d] == 0 ? exterior : v - sv_[d];
+          else
+            neighbor = c[d] + 1 == n_[d] ? exterior : v + sv_[d];
+          faces[num_faces++] = {cell_id(c, shift, d), neighbor};
+        }
+      }
+      sort_prefix(faces, num_faces);
+      for (int j = num_faces; j-- > 0;) {
+        Index a = ds_find_set(v);
+        Index b = ds_find_set(faces[j].second);
+        if (a == b) {
+          negative_faces.push_back({faces[j].first, v});
+          continue;
+        }
+        if (a == exterior || (b != exterior && rank_[a] > rank_[b])) std::swap(a, b);
+        ds_parent_[a] = b;
+        if (a != v) out(out_value(v), out_value(a));
+      }
+    }
+    std::reverse(negative_faces.begin(), negative_faces.end());
+    ds_parent_ = std::vector<Index>();
+  }
+
+  template <class Out>
+  void reduce(Out&& out) {
+    GUDHI_CHECK(positive_edges.size() == negative_faces.size(),
+                std::logic_error("Bug in Gudhi: the cubical complex must be contractible"));
+    // Position of the positive edges in the filtration, sorted by id
+    std::vector<std::pair<Index, Index>> edge_positions(positive_edges.size());
+    for (Index i = 0; i < positive_edges.size(); ++i) edge_positions[i] = {positive_edges[i].id, i};
+    std::sort(edge_positions.begin(), edge_positions.end());
+    auto position = [&](Index e) {
+      auto it = std::lower_bound(edge_positions.begin(), edge_positions.end(), std::make_pair(e, Index(0)));
+      return (it != edge_positions.end() && it->first == e) ? it->second : null_index;
+    };
+
+    std::vector<std::vector<Index>> columns(negative_faces.size());
+    std::vector<Index> pivot_of(positive_edges.size(), null_index);
+    std::vector<Index> sum;
+    for (Index j = 0; j < negative_faces.size(); ++j) {
+      Index w = negative_faces[j].id / 3;
+      int d = negative_faces[j].id % 3;
+      int d1 = (d + 1) % 3, d2 = (d + 2) % 3;
+      std::vector<Index>& column = columns[j];
+      for (Index e : {3 * w + d1, 3 * (w + sw_[d2]) + d1, 3 * w + d2, 3 * (w + sw_[d1]) + d2}) {
+        Index p = position(e);
+        if (p != null_index) column.push_back(p);
+      }
+      std::sort(column.begin(), column.end());
+      while (!column.empty()) {
+        Index pivot_column = pivot_of[column.back()];
+        if (pivot_column == null_index) {
+          pivot_of[column.back()] = j;
+          Index birth = positive_edges[column.back()].top_cell, death = negative_faces[j].top_cell;
+          if (birth != death) out(out_value(birth), out_value(death));
+          break;
+        }
+        sum.clear();
+        std::set_symmetric_difference(column.begin(), column.end(), columns[pivot_column].begin(),
+                                      columns[pivot_column].end(), std::back_inserter(sum));
+        column.swap(sum);
+      }
+      GUDHI_CHECK(!column.empty(), std::logic_error("Bug in Gudhi: a negative face has a zero column"));
+    }
+  }
+
+  static constexpr Index null_index = static_cast<Index>(-1);
+};
+// Ideas for improvement:
+// * as in Persistence_on_rectangle, most edges and faces are paired locally around their owner, and could be paired
+//   directly when the voxels are visited instead of going through the union-find.
+// * the H1 reduction is sequential, and could use the twist optimization with cohomology for hard inputs.
+
+/**
+ * @private
+ * Compute the persistence diagram of a function on a 3d cubical complex, defined as a lower-star filtration of the
+ * values at the top-dimensional cells.
+ *
+ * @tparam output_index If false, each argument of the out functors is a filtration value. If true, it is instead the
+ *   index of this filtration value in the input.
+ * @tparam Filtration_value Must be comparable with `operator<`.
+ * @tparam Index This is used to index the cells, so it must be large enough to represent 3 times the number of
+ *   vertices \f$(n\_layers+1)(n\_rows+1)(n\_cols+1)\f$.
+ * @param[in] input Pointer to `n_layers*n_rows*n_cols` filtration values for the cubes. Note that the values are assumed
+ *   to be stored in C order, unlike `Gudhi::cubical_complex::Bitmap_cubical_complex` (you can exchange `n_layers` and
+ *   `n_cols` for compatibility).
+ * @param[in] n_layers number of layers of `input`.
+ * @param[in] n_rows number of rows of `input`.
+ * @param[in] n_cols number of columns of `input`.
+ * @param[out] out0 For each interval (b, d) in the persistence diagram of dimension 0, the function calls `out0(b, d)`.
+ *   The intervals whose birth and death come from the same top-dimensional cell (of persistence 0) are not reported.
+ * @param[out] out1 Same as `out0` for persistence in dimension 1.
+ * @param[out] out2 Same as `out0` for persistence in dimension 2.
+ * @returns The global minimum, which is not paired and is thus the birth of an infinite persistence interval of
+ *   dimension 0.
+ */
+template <bool output_index = false, typename Filtration_value, typename Index, typename Out0, typename Out1,
+          typename Out2>
+auto persistence_on_cube_from_top_cells(Filtration_value const* input, Index n_layers, Index n_rows, Index n_cols,
+                                        Out0&&out0, Out1&&out1, Out2&&out2){
+#ifdef GUDHI_DETAILED_TIMES
+  Gudhi::Clock clock;
+#endif
+  GUDHI_CHECK(n_layers >= 1 && n_rows >= 1 && n_cols >= 1, std::domain_error("The complex must not be empty"));
+  Persistence_on_cube<Filtration_value, Index, output_index> X;
+  X.init(input, n_layers, n_rows, n_cols);
+  X.sort_top_cells();
+#ifdef GUDHI_DETAILED_TIMES
+    std::clog << "sort: " << clock; clock.begin();
+#endif
+  X.primal(out0);
+#ifdef GUDHI_DETAILED_TIMES
+    std::clog << "primal pass: " << clock; clock.begin();
+#endif
+  X.dual(out2);
+#ifdef GUDHI_DETAILED_TIMES
+    std::clog << "dual pass: " << clock; clock.begin();
+#endif
+  X.reduce(out1);
+#ifdef GUDHI_DETAILED_TIMES
+    std::clog << "H1 reduction: " << clock;
+#endif
+  return X.out_value(X.order_[0]);
+}
+}  // namespace Gudhi::cubical_complex
+
+#endif  // PERSISTENCE_ON_CUBE_H
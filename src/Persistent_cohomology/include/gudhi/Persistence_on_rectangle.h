@@ -28,6 +28,9 @@
 
 #ifdef GUDHI_USE_TBB
  #include <tbb/parallel_sort.h>
+ #include <tbb/parallel_reduce.h>
+ #include <tbb/blocked_range.h>
+ #include <tbb/task_arena.h>
 #endif
 
 #ifdef DEBUG_TRACES
@@ -35,9 +38,14 @@
 #endif
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <numeric>  // for std::iota
 #include <algorithm>
+#include <iterator>  // for std::back_inserter
 #include <stdexcept>
 #include <cstddef>
+#include <tuple>  // for std::tie
+#include <utility>  // for std::pair
 
 namespace Gudhi::cubical_complex {
 
@@ -557,9 +565,9 @@ struct Persistence_on_rectangle {
 // * To handle very big instances, we could remove data_v_ and recompute it on demand as the min of the inputs of i,
 //   i+1, i+dy and i+dy+1. On hard instances, it wouldn't save that much memory (and it is a bit slower). On easy
 //   instances, if we also remove the calls to reserve(), the saving is less negligible, but we still have ds_parent_*_
-//   that take about as much space as the input. We could, on a subarray, fill a dense ds_parent, then reduce it and
-//   export only the critical vertices and boundary to some sparse datastructure, but it doesn't seem worth the trouble
-//   for now.
+//   that take about as much space as the input. Tiled_persistence_on_rectangle below fills a dense ds_parent on
+//   bands of rows, reduces it, and exports only the merges that involve the boundary of the band to a sparse
+//   datastructure.
 
 /**
  * @private
@@ -612,6 +620,542 @@ auto persistence_on_rectangle_from_top_cells(Filtration_value const* input, Inde
 #endif
   return X.global_min;
 }
+
+// Tiled version of Persistence_on_rectangle, for inputs so large that arrays of the size of the input do not fit in
+// memory (the input itself may be memory mapped). The squares are split in bands of consecutive rows, that are
+// processed independently (in parallel with TBB) with dense arrays of the size of the band only.
+// It works on the full cubical complex (with the boundary vertices). Each cell has the filtration value of its
+// smallest adjacent square in the order (value, index), its owner, and the cells of the same dimension and value are
+// ordered by owner then by id. As in Persistence_on_rectangle, each vertex is paired with its first edge and each
+// square with its first edge in the dual, which are all known from the neighbors of their owner, and only the other
+// (critical) edges are sorted and go through the union-find.
+// * H0: union-find on the vertices of the band along its edges. The vertices on the rows shared with the neighboring
+//   bands are on the boundary. When the younger of 2 merged components does not contain any boundary vertex, it
+//   cannot be connected to anything outside the band, and the pair is final. Otherwise, the merge is exported with
+//   the 2 representatives, which are kept as nodes of the merges of the neighboring bands.
+// * H1: the same in the dual, with the squares of the band, the first row of squares of the next band, and the
+//   exterior cell (which is on the boundary of all the bands).
+// Two adjacent bands are then joined by running the same union-find on their exported merges, with only the outer
+// rows of the union as boundary: a component that does not contain a node of these rows is final, so only the merges
+// that involve the outer rows are kept. Joining all the bands from left to right (or as a tree with TBB) gives the
+// remaining pairs, and at no time are the merges of more than a few bands in memory.
+template <class Filtration_value, class Index = std::size_t, bool output_index = false>
+struct Tiled_persistence_on_rectangle {
+  Filtration_value const* input_p;
+  Filtration_value input(Index i) const { return input_p[i]; }
+  auto out_value(Index i) const {
+    if constexpr (output_index)
+      return i;
+    else
+      return input(i);
+  }
+  Index n_rows, n_cols;
+
+  // Is square a before square b?
+  bool square_less(Index a, Index b) const {
+    Filtration_value fa = input(a), fb = input(b);
+    if (fa < fb) return true;
+    if (fb < fa) return false;
+    return a < b;
+  }
+  Index min_square(Index a, Index b) const { return square_less(b, a) ? b : a; }
+
+  struct Edge {
+    Filtration_value f;
+    Index square;  // smallest adjacent square, which gives f
+    Index id;      // 2 * (index of its first vertex) + 1 if vertical
+    bool operator<(Edge const& other) const {
+      if (f < other.f) return true;
+      if (other.f < f) return false;
+      return std::tie(square, id) < std::tie(other.square, other.id);
+    }
+  };
+  // Merge of the components of 2 representatives along an edge
+  struct Merge {
+    Edge e;
+    Index a, b;
+  };
+  // Merges exported by the bands of rows [y0, y1[, in the order of the pass, and their smallest square
+  struct Band_summary {
+    Index y0, y1;
+    std::vector<Merge> primal, dual;
+    Index min_square;
+    bool empty = true;
+  };
+
+  Index vertex_index(Index r, Index c) const { return r * (n_cols + 1) + c; }
+  // Smallest square adjacent to a vertex
+  Index vertex_square(Index v) const {
+    Index r = v / (n_cols + 1), c = v % (n_cols + 1);
+    Index rmin = r == 0 ? 0 : r - 1, rmax = r == n_rows ? r - 1 : r;
+    Index cmin = c == 0 ? 0 : c - 1, cmax = c == n_cols ? c - 1 : c;
+    Index s = rmin * n_cols + cmin;
+    for (Index y = rmin; y <= rmax; ++y)
+      for (Index x = cmin; x <= cmax; ++x) s = min_square(s, y * n_cols + x);
+    return s;
+  }
+  bool vertex_less(Index u, Index v) const {
+    Index su = vertex_square(u), sv = vertex_square(v);
+    if (su != sv) return square_less(su, sv);
+    return u < v;
+  }
+  // The exterior (index n_rows * n_cols) is the oldest cell of the dual
+  bool dual_older(Index a, Index b) const {
+    const Index exterior = n_rows * n_cols;
+    if (a == exterior) return true;
+    if (b == exterior) return false;
+    return square_less(b, a);
+  }
+
+  // Sides of a square, in the order of their ids, and its corners
+  enum : unsigned char { bottom = 1, left = 2, right = 4, top = 8, bottom_left = 16, bottom_right = 32, top_left = 64,
+                         top_right = 128 };
+
+  // The sides that the square s owns, i.e. whose other adjacent square (if any) is after s, and the corners that it
+  // owns, whose other adjacent squares are all after s.
+  unsigned char owned_cells(Index s) const {
+    Index r = s / n_cols, c = s % n_cols;
+    bool first_row = r == 0, last_row = r + 1 == n_rows, first_col = c == 0, last_col = c + 1 == n_cols;
+    unsigned char m = 0;
+    if (first_row || square_less(s, s - n_cols)) m |= bottom;
+    if (first_col || square_less(s, s - 1)) m |= left;
+    if (last_col || square_less(s, s + 1)) m |= right;
+    if (last_row || square_less(s, s + n_cols)) m |= top;
+    if ((m & (bottom | left)) == (bottom | left) && (first_row || first_col || square_less(s, s - n_cols - 1)))
+      m |= bottom_left;
+    if ((m & (bottom | right)) == (bottom | right) && (first_row || last_col || square_less(s, s - n_cols + 1)))
+      m |= bottom_right;
+    if ((m & (top | left)) == (top | left) && (last_row || first_col || square_less(s, s + n_cols - 1)))
+      m |= top_left;
+    if ((m & (top | right)) == (top | right) && (last_row || last_col || square_less(s, s + n_cols + 1)))
+      m |= top_right;
+    return m;
+  }
+  // The last side owned by a square is its first edge in the dual pass, where the square is still alone: it pairs
+  // with the square, and closes the boundary of the square in the primal pass.
+  static unsigned char last_side(unsigned char m) {
+    for (unsigned char side : {top, right, left, bottom})
+      if (m & side) return side;
+    return 0;
+  }
+  // The first side of a corner owned by the square is the first edge of this vertex in the primal pass, where it is
+  // still alone: it pairs with the vertex, and closes the dual cycle around the vertex in the dual pass. Returns the
+  // corner paired with a side (the bottom side pairs with the right corner if both bottom corners are owned), or 0.
+  static unsigned char paired_corner(unsigned char m, unsigned char side) {
+    switch (side) {
+      case bottom:
+        return (m & bottom_right) ? bottom_right : (m & bottom_left);
+      case left:
+        return m & top_left;
+      case right:
+        return m & top_right;
+      default:
+        return 0;
+    }
+  }
+  Edge make_edge(Index s, unsigned char side) const {
+    Index v = vertex_index(s / n_cols + (side == top), s % n_cols + (side == right));
+    return {input(s), s, 2 * v + (side == left || side == right)};
+  }
+  unsigned char side_of(Edge const& e) const {
+    Index w = e.id / 2;
+    if (e.id & 1) return w % (n_cols + 1) == e.square % n_cols ? left : right;
+    return w / (n_cols + 1) == e.square / n_cols ? bottom : top;
+  }
+
+  // How an edge is handled in a pass over a band: not at all (outside of the band, or known to connect cells that
+  // are already connected), by pairing it with a cell that is still alone, or with the union-find.
+  enum Role { ignored, paired, critical };
+
+  // The band of rows [y0, y1[ and the cells that its passes use. Each pass only contains some of the edges that touch
+  // the band, so that every edge is processed in exactly one band:
+  // * primal: the vertices of the rows [y0, y1], the vertical edges of the rows [y0, y1[, and the horizontal edges of
+  //   the rows [y0, y1[, and of the last row in the last band.
+  // * dual: the squares of the rows [y0, min(y1, n_rows - 1)] and the exterior, the vertical edges of the rows
+  //   [y0, y1[, and the horizontal edges of the rows ]y0, y1], and of the row 0 in the first band.
+  // The edges of the band are owned by the squares of the rows [max(y0, 1) - 1, min(y1, n_rows - 1)].
+  struct Band {
+    Index y0, y1;
+    Index first_row, last_row;
+    std::vector<unsigned char> owned;  // cells owned by the squares of the rows [first_row, last_row]
+  };
+
+  bool primal_on_boundary(Band const& band, Index vertex_row) const {
+    return (band.y0 > 0 && vertex_row == band.y0) || (band.y1 < n_rows && vertex_row == band.y1);
+  }
+  bool dual_on_boundary(Band const& band, Index square_row) const {
+    return (band.y0 > 0 && square_row == band.y0) || (band.y1 < n_rows && square_row == band.y1);
+  }
+
+  Role primal_role(Band const& band, Index s, unsigned char m, unsigned char side) const {
+    const Index y0 = band.y0, y1 = band.y1;
+    const Index r = s / n_cols, row = r + (side == top);
+    if (row < y0 || row > y1) return ignored;
+    if (row == y1 && (side == left || side == right || y1 < n_rows)) return ignored;
+    // The other sides are before, and in the band if all the rows of the square are
+    if (side == last_side(m) && r >= y0 && r < y1 && (r + 1 < y1 || y1 == n_rows)) return ignored;
+    unsigned char corner = paired_corner(m, side);
+    if (corner && !primal_on_boundary(band, r + (corner == top_left || corner == top_right))) return paired;
+    return critical;
+  }
+
+  Role dual_role(Band const& band, Index s, unsigned char m, unsigned char side) const {
+    const Index y0 = band.y0, y1 = band.y1;
+    const Index r = s / n_cols, row = r + (side == top);
+    if (side == left || side == right) {
+      if (r < y0 || r >= y1) return ignored;
+    } else if (row > y1 || (row <= y0 && !(row == 0 && y0 == 0))) {
+      return ignored;
+    }
+    // The other edges around the vertex are before (in the order of this pass), and in the band if all those around
+    // its row are
+    if (unsigned char corner = paired_corner(m, side)) {
+      Index vertex_row = r + (corner == top_left || corner == top_right);
+      if ((vertex_row == 0 || y0 < vertex_row) && (vertex_row < y1 || (vertex_row == y1 && y1 == n_rows)))
+        return ignored;
+    }
+    if (side == last_side(m) && !dual_on_boundary(band, r)) return paired;
+    return critical;
+  }
+
+  unsigned char owned(Band const& band, Index s) const { return band.owned[s - band.first_row * n_cols]; }
+
+  // Dense union-find on the cells of a band, with a flag for the components that contain a boundary cell
+  struct Band_union_find {
+    std::vector<Index> parent;
+    std::vector<char> on_boundary;
+    explicit Band_union_find(Index n) : parent(n), on_boundary(n, false) {
+      std::iota(parent.begin(), parent.end(), Index(0));
+    }
+    Index find(Index v) {
+      // Path halving
+      Index p = parent[v];
+      Index gp = parent[p];
+      while (p != gp) {
+        parent[v] = gp;
+        v = gp;
+        p = parent[v];
+        gp = parent[p];
+      }
+      return p;
+    }
+  };
+
+  // Merges the components of the local cells u and v along e, and either outputs the final pair, as (birth, death)
+  // square indices, or exports the merge with global cell indices.
+  template <class Local_to_global, class Older, class Out>
+  void process_edge(Band_union_find& uf, Edge const& e, Index u, Index v, Local_to_global&& global, Older&& older,
+                    bool primal, std::vector<Merge>& exported, Out&& out) {
+    Index a = uf.find(u), b = uf.find(v);
+    if (a == b) return;
+    if (!older(global(a), global(b))) std::swap(a, b);
+    uf.parent[b] = a;
+    if (uf.on_boundary[b]) {
+      exported.push_back({e, global(a), global(b)});
+      uf.on_boundary[a] = true;
+    } else {
+      out(primal ? vertex_square(global(b)) : e.square, primal ? e.square : global(b));
+    }
+  }
+
+  // Local pairing, as in Persistence_on_rectangle: computes the cells owned by each square, and returns the edges
+  // that are critical in one of the passes, sorted.
+  std::vector<Edge> fill_and_pair(Band& band) const {
+    band.first_row = band.y0 == 0 ? 0 : band.y0 - 1;
+    band.last_row = std::min(band.y1, n_rows - 1);
+    const Index begin = band.first_row * n_cols, end = (band.last_row + 1) * n_cols;
+    band.owned.resize(end - begin);
+    std::vector<Edge> edges;
+    for (Index s = begin; s < end; ++s) {
+      const unsigned char m = band.owned[s - begin] = owned_cells(s);
+      for (unsigned char side : {bottom, left, right, top}) {
+        if ((m & side) && (primal_role(band, s, m, side) == critical || dual_role(band, s, m, side) == critical))
+          edges.push_back(make_edge(s, side));
+      }
+    }
+#ifdef GUDHI_USE_TBB
+    tbb::parallel_sort(edges.begin(), edges.end());
+#else
+    std::sort(edges.begin(), edges.end());
+#endif
+    return edges;
+  }
+
+  template <class Out>
+  void primal_band(Band const& band, std::vector<Edge> const& edges, std::vector<Merge>& exported, Out&& out) {
+    const Index y0 = band.y0, y1 = band.y1;
+    const Index width = n_cols + 1;
+    Band_union_find uf((y1 - y0 + 1) * width);
+    for (Index c = 0; c < width; ++c) {
+      if (y0 > 0) uf.on_boundary[c] = true;
+      if (y1 < n_rows) uf.on_boundary[(y1 - y0) * width + c] = true;
+    }
+    auto local = [&](Index v) { return v - y0 * width; };
+    auto global = [&](Index v) { return v + y0 * width; };
+    auto older = [this](Index u, Index v) { return vertex_less(u, v); };
+    auto ends = [&](Edge const& e, unsigned char side) {
+      Index v = local(e.id / 2);
+      return std::make_pair(v, side == left || side == right ? v + width : v + 1);
+    };
+    // The paired vertices are alone until their edge, and die in it without being the older vertex (the other end
+    // of the bottom side if the 2 bottom corners are owned has a smaller index). Nothing can reach them before, so
+    // they can be attached in any order.
+    for (Index s = band.first_row * n_cols; s < (band.last_row + 1) * n_cols; ++s) {
+      const unsigned char m = owned(band, s);
+      for (unsigned char side : {bottom, left, right}) {
+        if ((m & side) && primal_role(band, s, m, side) == paired) {
+          auto [p, q] = ends(make_edge(s, side), side);
+          if (paired_corner(m, side) == bottom_left)
+            uf.parent[p] = q;
+          else
+            uf.parent[q] = p;
+        }
+      }
+    }
+    for (Edge const& e : edges) {
+      const unsigned char side = side_of(e);
+      if (primal_role(band, e.square, owned(band, e.square), side) != critical) continue;
+      auto [p, q] = ends(e, side);
+      process_edge(uf, e, p, q, global, older, true, exported, out);
+    }
+  }
+
+  template <class Out>
+  void dual_band(Band const& band, std::vector<Edge> const& edges, std::vector<Merge>& exported, Out&& out) {
+    const Index y0 = band.y0;
+    const Index num_squares = (band.last_row - y0 + 1) * n_cols;
+    const Index exterior = n_rows * n_cols;
+    Band_union_find uf(num_squares + 1);
+    uf.on_boundary[num_squares] = true;
+    for (Index c = 0; c < n_cols; ++c) {
+      if (y0 > 0) uf.on_boundary[c] = true;
+      if (band.y1 < n_rows) uf.on_boundary[(band.y1 - y0) * n_cols + c] = true;
+    }
+    auto local = [&](Index s) { return s == exterior ? num_squares : s - y0 * n_cols; };
+    auto global = [&](Index s) { return s == num_squares ? exterior : s + y0 * n_cols; };
+    auto older = [this](Index a, Index b) { return dual_older(a, b); };
+    // The square on the other side of a side of s
+    auto across = [&](Index s, unsigned char side) {
+      Index r = s / n_cols, c = s % n_cols;
+      switch (side) {
+        case bottom: return r == 0 ? exterior : s - n_cols;
+        case left: return c == 0 ? exterior : s - 1;
+        case right: return c + 1 == n_cols ? exterior : s + 1;
+        default: return r + 1 == n_rows ? exterior : s + n_cols;
+      }
+    };
+    // The paired squares are alone until their last side, and die in it
+    for (Index s = y0 * n_cols; s < (band.last_row + 1) * n_cols; ++s) {
+      const unsigned char m = owned(band, s);
+      const unsigned char side = last_side(m);
+      if (side && dual_role(band, s, m, side) == paired) uf.parent[local(s)] = local(across(s, side));
+    }
+    for (Edge const& e : boost::adaptors::reverse(edges)) {
+      const unsigned char side = side_of(e);
+      if (dual_role(band, e.square, owned(band, e.square), side) != critical) continue;
+      process_edge(uf, e, local(e.square), local(across(e.square, side)), global, older, false, exported, out);
+    }
+  }
+
+  // Processes the band of rows [y0, y1[. The final pairs are given to out0 and out1 as square indices.
+  template <class Out0, class Out1>
+  Band_summary process_band(Index y0, Index y1, Out0&& out0, Out1&& out1) {
+    Band_summary summary{y0, y1, {}, {}, y0 * n_cols, false};
+    for (Index s = y0 * n_cols + 1; s < y1 * n_cols; ++s) summary.min_square = min_square(summary.min_square, s);
+    Band band{y0, y1, 0, 0, {}};
+    std::vector<Edge> edges = fill_and_pair(band);
+    primal_band(band, edges, summary.primal, out0);
+    dual_band(band, edges, summary.dual, out1);
+    return summary;
+  }
+
+  // Union-find on the merges of adjacent bands, sorted in the order of the pass, where the nodes for which on_boundary
+  // is true are on the boundary of their union. Returns the merges that involve this boundary, in the same order.
+  template <class Older, class Birth, class On_boundary, class Out>
+  std::vector<Merge> join_merges(std::vector<Merge> const& merges, Older&& older, Birth&& birth_and_death,
+                                 On_boundary&& on_boundary, Out&& out) {
+    // Number the distinct nodes: ends[2 * i] and ends[2 * i + 1] get the numbers of the ends of the i-th merge
+    std::vector<std::pair<Index, Index>> sorted_ends(2 * merges.size());
+    for (Index i = 0; i < merges.size(); ++i) {
+      sorted_ends[2 * i] = {merges[i].a, 2 * i};
+      sorted_ends[2 * i + 1] = {merges[i].b, 2 * i + 1};
+    }
+    std::sort(sorted_ends.begin(), sorted_ends.end());
+    std::vector<Index> nodes, ends(sorted_ends.size());
+    for (auto const& [node, end] : sorted_ends) {
+      if (nodes.empty() || nodes.back() != node) nodes.push_back(node);
+      ends[end] = nodes.size() - 1;
+    }
+    sorted_ends = {};
+    Band_union_find uf(nodes.size());
+    for (Index i = 0; i < nodes.size(); ++i) uf.on_boundary[i] = on_boundary(nodes[i]);
+    std::vector<Merge> exported;
+    for (Index i = 0; i < merges.size(); ++i) {
+      auto const& m = merges[i];
+      Index a = uf.find(ends[2 * i]), b = uf.find(ends[2 * i + 1]);
+      if (a == b) continue;
+      if (!older(nodes[a], nodes[b])) std::swap(a, b);
+      uf.parent[b] = a;
+      if (uf.on_boundary[b]) {
+        exported.push_back({m.e, nodes[a], nodes[b]});
+        uf.on_boundary[a] = true;
+      } else {
+        auto [birth, death] = birth_and_death(m.e, nodes[b]);
+        out(birth, death);
+      }
+    }
+    return exported;
+  }
+
+  // Joins the summaries of the bands [l.y0, l.y1[ and [l.y1, r.y1[
+  template <class Out0, class Out1>
+  Band_summary join(Band_summary&& l, Band_summary&& r, Out0&& out0, Out1&& out1) {
+    if (l.empty) return std::move(r);
+    if (r.empty) return std::move(l);
+    GUDHI_CHECK(l.y1 == r.y0, std::logic_error("Bug in Gudhi: joining bands that are not adjacent"));
+    Band_summary summary{l.y0, r.y1, {}, {}, min_square(l.min_square, r.min_square), false};
+    const Index y0 = summary.y0, y1 = summary.y1;
+    const Index width = n_cols + 1;
+    const Index exterior = n_rows * n_cols;
+    auto row_on_boundary = [&](Index row) { return (y0 > 0 && row == y0) || (y1 < n_rows && row == y1); };
+
+    std::vector<Merge> merges;
+    merges.reserve(l.primal.size() + r.primal.size());
+    std::merge(l.primal.begin(), l.primal.end(), r.primal.begin(), r.primal.end(), std::back_inserter(merges),
+               [](Merge const& m1, Merge const& m2) { return m1.e < m2.e; });
+    l.primal = std::vector<Merge>();
+    r.primal = std::vector<Merge>();
+    summary.primal = join_merges(
+        merges, [this](Index u, Index v) { return vertex_less(u, v); },
+        [this](Edge const& e, Index v) { return std::make_pair(vertex_square(v), e.square); },
+        [&](Index v) { return row_on_boundary(v / width); }, out0);
+
+    merges.clear();
+    merges.reserve(l.dual.size() + r.dual.size());
+    std::merge(l.dual.begin(), l.dual.end(), r.dual.begin(), r.dual.end(), std::back_inserter(merges),
+               [](Merge const& m1, Merge const& m2) { return m2.e < m1.e; });
+    l.dual = std::vector<Merge>();
+    r.dual = std::vector<Merge>();
+    summary.dual = join_merges(
+        merges, [this](Index a, Index b) { return dual_older(a, b); },
+        [](Edge const& e, Index s) { return std::make_pair(e.square, s); },
+        [&](Index s) { return s == exterior || row_on_boundary(s / n_cols); }, out1);
+    return summary;
+  }
+};
+
+/**
+ * @private
+ * Same as `persistence_on_rectangle_from_top_cells`, for inputs that are too large for the arrays of the size of the
+ * input used by this function. The squares are processed by bands of rows, with arrays of the size of the bands, and
+ * only the merges of components that touch the boundary of their band are kept, to be resolved when the neighboring
+ * bands are joined. With TBB, the bands are processed in parallel.
+ *
+ * The pairs whose birth and death come from the same square (of persistence 0) are not reported, and the out functors
+ * are called by one thread at a time. It is slower than `persistence_on_rectangle_from_top_cells` (about twice on a
+ * random image that fits in memory, see `persistence_2d.cpp`), since it works on the boundary of the image too and
+ * its union-find passes are restricted to the bands.
+ *
+ * @param[in] max_memory Approximate memory, in bytes, for the bands processed at the same time. It covers the local
+ *   pairing, the critical edges and the union-find of each band, the buffered output, and the merges that are kept
+ *   for the boundary of the bands, estimated from the size of a row (they are proportional to it on usual inputs).
+ *   Bands of a few rows work, but when the budget only allows very thin bands, most cells are on their boundary and
+ *   joining the bands dominates the running time.
+ */
+template <bool output_index = false, typename Filtration_value, typename Index, typename Out0, typename Out1>
+auto persistence_on_rectangle_from_top_cells_tiled(Filtration_value const* input, Index n_rows, Index n_cols,
+                                                   Out0&& out0, Out1&& out1,
+                                                   std::size_t max_memory = std::size_t(1) << 30) {
+  GUDHI_CHECK(n_rows >= 1 && n_cols >= 1, std::domain_error("The complex must not be empty"));
+  using Tiled = Tiled_persistence_on_rectangle<Filtration_value, Index, output_index>;
+  using Summary = typename Tiled::Band_summary;
+  Tiled X;
+  X.input_p = input;
+  X.n_rows = n_rows;
+  X.n_cols = n_cols;
+
+#ifdef GUDHI_USE_TBB
+  std::size_t num_threads = tbb::this_task_arena::max_concurrency();
+#else
+  std::size_t num_threads = 1;
+#endif
+  // Per row of a band: the cells owned by each square, one node of union-find with its flag, and the critical edges
+  // (one per square at most for usual inputs: all the squares and vertices but the local extrema are paired). Per
+  // band: 2 more rows of squares, the output buffer, and the merges kept for the boundary rows, about 2 per boundary
+  // cell and pass, for the band and for the summary it is joined with.
+  const std::size_t row_size = n_cols + 1;
+  const std::size_t bytes_per_square = 1 + sizeof(typename Tiled::Edge);
+  const std::size_t bytes_per_row = row_size * (bytes_per_square + sizeof(Index) + 1);
+  constexpr std::size_t buffer_size = 1 << 12;
+  const std::size_t bytes_per_band = 2 * row_size * bytes_per_square +
+                                     2 * buffer_size * sizeof(std::pair<Index, Index>) +
+                                     2 * 2 * 2 * 2 * row_size * sizeof(typename Tiled::Merge);
+  const std::size_t memory_per_thread = max_memory / num_threads;
+  Index band_rows = static_cast<Index>(std::max<std::size_t>(
+      1, memory_per_thread > bytes_per_band ? (memory_per_thread - bytes_per_band) / bytes_per_row : 0));
+  band_rows = std::min(band_rows, n_rows);
+  Index num_bands = (n_rows + band_rows - 1) / band_rows;
+
+  // Each task buffers its pairs and outputs them in batches
+  std::mutex out_mutex;
+  struct Buffered_output {
+    std::mutex& mutex;
+    Out0& out0;
+    Out1& out1;
+    Tiled const& X;
+    std::vector<std::pair<Index, Index>> pairs0, pairs1;
+    void flush() {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto [b, d] : pairs0) out0(X.out_value(b), X.out_value(d));
+      for (auto [b, d] : pairs1) out1(X.out_value(b), X.out_value(d));
+      pairs0.clear();
+      pairs1.clear();
+    }
+    void add(std::vector<std::pair<Index, Index>>& pairs, Index b, Index d) {
+      if (b == d) return;
+      pairs.emplace_back(b, d);
+      if (pairs.size() == buffer_size) flush();
+    }
+    auto dim0() { return [this](Index b, Index d) { add(pairs0, b, d); }; }
+    auto dim1() { return [this](Index b, Index d) { add(pairs1, b, d); }; }
+  };
+  auto band_range = [&](Index band) {
+    return std::make_pair(band * band_rows, std::min(n_rows, (band + 1) * band_rows));
+  };
+
+#ifdef GUDHI_USE_TBB
+  Summary summary = tbb::parallel_reduce(
+      tbb::blocked_range<Index>(0, num_bands, 1), Summary{},
+      [&](tbb::blocked_range<Index> const& range, Summary summary) {
+        Buffered_output out{out_mutex, out0, out1, X, {}, {}};
+        for (Index band = range.begin(); band != range.end(); ++band) {
+          auto [y0, y1] = band_range(band);
+          summary = X.join(std::move(summary), X.process_band(y0, y1, out.dim0(), out.dim1()), out.dim0(),
+                           out.dim1());
+        }
+        out.flush();
+        return summary;
+      },
+      [&](Summary l, Summary r) {
+        Buffered_output out{out_mutex, out0, out1, X, {}, {}};
+        Summary summary = X.join(std::move(l), std::move(r), out.dim0(), out.dim1());
+        out.flush();
+        return summary;
+      });
+#else
+  Summary summary;
+  Buffered_output out{out_mutex, out0, out1, X, {}, {}};
+  for (Index band = 0; band < num_bands; ++band) {
+    auto [y0, y1] = band_range(band);
+    summary = X.join(std::move(summary), X.process_band(y0, y1, out.dim0(), out.dim1()), out.dim0(), out.dim1());
+  }
+  out.flush();
+#endif
+  // The union of all the bands has no boundary (the exterior is never the younger component)
+  GUDHI_CHECK(summary.primal.empty() && summary.dual.empty(),
+              std::logic_error("Bug in Gudhi: merges left after joining all the bands"));
+  return X.out_value(summary.min_square);
+}
 }  // namespace Gudhi::cubical_complex
 
 #endif  // PERSISTENCE_ON_RECTANGLE_H
@@ -0,0 +1,144 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "persistence_on_cube"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Persistence_on_cube.h>
+
+#include <vector>
+#include <array>
+#include <random>
+#include <limits>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort
+#include <cstddef>  // for std::size_t
+
+using Diagrams = std::array<std::vector<std::pair<double, double>>, 3>;
+
+// Intervals of positive length, and the infinite one, with Bitmap_cubical_complex and Persistent_cohomology
+Diagrams bitmap_persistence(const std::vector<double>& data, std::size_t n_layers, std::size_t n_rows,
+                            std::size_t n_cols) {
+  using Bitmap = Gudhi::cubical_complex::Bitmap_cubical_complex<
+      Gudhi::cubical_complex::Bitmap_cubical_complex_base<double>>;
+  // Bitmap_cubical_complex stores the first coordinate contiguously, the columns here
+  Bitmap bitmap(std::vector<unsigned>{static_cast<unsigned>(n_cols), static_cast<unsigned>(n_rows),
+                                      static_cast<unsigned>(n_layers)},
+                data, true);
+  Gudhi::persistent_cohomology::Persistent_cohomology<Bitmap, Gudhi::persistent_cohomology::Field_Zp> pcoh(bitmap);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  Diagrams diagrams;
+  for (auto const& pair : pcoh.get_persistent_pairs()) {
+    auto birth = std::get<0>(pair), death = std::get<1>(pair);
+    double b = bitmap.filtration(birth);
+    double d = death == bitmap.null_simplex() ? std::numeric_limits<double>::infinity() : bitmap.filtration(death);
+    if (b < d) diagrams[bitmap.dimension(birth)].emplace_back(b, d);
+  }
+  for (auto& diagram : diagrams) std::sort(diagram.begin(), diagram.end());
+  return diagrams;
+}
+
+Diagrams cube_persistence(const std::vector<double>& data, std::size_t n_layers, std::size_t n_rows,
+                          std::size_t n_cols) {
+  Diagrams diagrams;
+  auto out = [&diagrams](int dim) {
+    return [&diagrams, dim](double b, double d) {
+      if (b < d) diagrams[dim].emplace_back(b, d);
+    };
+  };
+  double global_min = Gudhi::cubical_complex::persistence_on_cube_from_top_cells(data.data(), n_layers, n_rows,
+                                                                                 n_cols, out(0), out(1), out(2));
+  diagrams[0].emplace_back(global_min, std::numeric_limits<double>::infinity());
+  for (auto& diagram : diagrams) std::sort(diagram.begin(), diagram.end());
+  return diagrams;
+}
+
+// Same with output_index = true, the indices being converted to values
+Diagrams cube_persistence_by_index(const std::vector<double>& data, std::size_t n_layers, std::size_t n_rows,
+                                   std::size_t n_cols) {
+  Diagrams diagrams;
+  auto out = [&diagrams, &data](int dim) {
+    return [&diagrams, &data, dim](std::size_t b, std::size_t d) {
+      if (data[b] < data[d]) diagrams[dim].emplace_back(data[b], data[d]);
+    };
+  };
+  std::size_t global_min = Gudhi::cubical_complex::persistence_on_cube_from_top_cells<true>(
+      data.data(), n_layers, n_rows, n_cols, out(0), out(1), out(2));
+  diagrams[0].emplace_back(data[global_min], std::numeric_limits<double>::infinity());
+  for (auto& diagram : diagrams) std::sort(diagram.begin(), diagram.end());
+  return diagrams;
+}
+
+void check_against_bitmap(const std::vector<double>& data, std::size_t n_layers, std::size_t n_rows,
+                          std::size_t n_cols) {
+  BOOST_TEST_CONTEXT("shape " << n_layers << "x" << n_rows << "x" << n_cols) {
+    Diagrams expected = bitmap_persistence(data, n_layers, n_rows, n_cols);
+    Diagrams diagrams = cube_persistence(data, n_layers, n_rows, n_cols);
+    Diagrams diagrams_by_index = cube_persistence_by_index(data, n_layers, n_rows, n_cols);
+    for (int dim = 0; dim < 3; ++dim) {
+      BOOST_TEST_CONTEXT("dimension " << dim) {
+        BOOST_CHECK(diagrams[dim] == expected[dim]);
+        BOOST_CHECK(diagrams_by_index[dim] == expected[dim]);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(persistence_on_cube_random) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<std::size_t> size(1, 6);
+  for (int i = 0; i < 300; ++i) {
+    std::size_t n_layers = size(gen), n_rows = size(gen), n_cols = size(gen);
+    // Few distinct values, for many ties
+    std::uniform_int_distribution<int> value(0, i % 2 == 0 ? 3 : 100);
+    std::vector<double> data(n_layers * n_rows * n_cols);
+    for (auto& x : data) x = value(gen);
+    check_against_bitmap(data, n_layers, n_rows, n_cols);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(persistence_on_cube_degenerate_shapes) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> value(0, 5);
+  std::vector<std::array<std::size_t, 3>> shapes{{1, 1, 1}, {1, 1, 9}, {1, 9, 1}, {9, 1, 1}, {1, 7, 8},
+                                                 {7, 1, 8}, {7, 8, 1}, {2, 2, 2}, {2, 1, 2}};
+  for (auto [n_layers, n_rows, n_cols] : shapes) {
+    std::vector<double> data(n_layers * n_rows * n_cols);
+    // Constant, increasing, decreasing and random values
+    std::fill(data.begin(), data.end(), 1.);
+    check_against_bitmap(data, n_layers, n_rows, n_cols);
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = i;
+    check_against_bitmap(data, n_layers, n_rows, n_cols);
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = -static_cast<double>(i);
+    check_against_bitmap(data, n_layers, n_rows, n_cols);
+    for (auto& x : data) x = value(gen);
+    check_against_bitmap(data, n_layers, n_rows, n_cols);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(persistence_on_cube_hollow_cube) {
+  // A voxel of value 0 in the middle of a 3x3x3 cube of value 1: a single component, and no void
+  std::vector<double> data(27, 1.);
+  data[13] = 0.;
+  Diagrams diagrams = cube_persistence(data, 3, 3, 3);
+  BOOST_CHECK(diagrams[0].size() == 1);
+  BOOST_CHECK(diagrams[2].empty());
+  check_against_bitmap(data, 3, 3, 3);
+
+  std::fill(data.begin(), data.end(), 2.);
+  data[13] = 3.;  // a voxel that enters last in the middle of a cube
+  diagrams = cube_persistence(data, 3, 3, 3);
+  BOOST_CHECK(diagrams[2] == (std::vector<std::pair<double, double>>{{2., 3.}}));
+  check_against_bitmap(data, 3, 3, 3);
+}
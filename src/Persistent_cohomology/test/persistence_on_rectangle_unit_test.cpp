@@ -0,0 +1,154 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "persistence_on_rectangle"
+#include <boost/test/unit_test.hpp>
+
+#include <gudhi/Bitmap_cubical_complex.h>
+#include <gudhi/Persistent_cohomology.h>
+#include <gudhi/Persistence_on_rectangle.h>
+
+#include <vector>
+#include <array>
+#include <random>
+#include <limits>
+#include <utility>  // for std::pair
+#include <algorithm>  // for std::sort
+#include <cstddef>  // for std::size_t
+
+using Diagrams = std::array<std::vector<std::pair<double, double>>, 2>;
+
+// Intervals of positive length, and the infinite one, with Bitmap_cubical_complex and Persistent_cohomology
+Diagrams bitmap_persistence(const std::vector<double>& data, std::size_t n_rows, std::size_t n_cols) {
+  using Bitmap = Gudhi::cubical_complex::Bitmap_cubical_complex<
+      Gudhi::cubical_complex::Bitmap_cubical_complex_base<double>>;
+  // Bitmap_cubical_complex stores the first coordinate contiguously, the columns here
+  Bitmap bitmap(std::vector<unsigned>{static_cast<unsigned>(n_cols), static_cast<unsigned>(n_rows)}, data, true);
+  Gudhi::persistent_cohomology::Persistent_cohomology<Bitmap, Gudhi::persistent_cohomology::Field_Zp> pcoh(bitmap);
+  pcoh.init_coefficients(2);
+  pcoh.compute_persistent_cohomology();
+  Diagrams diagrams;
+  for (auto const& pair : pcoh.get_persistent_pairs()) {
+    auto birth = std::get<0>(pair), death = std::get<1>(pair);
+    double b = bitmap.filtration(birth);
+    double d = death == bitmap.null_simplex() ? std::numeric_limits<double>::infinity() : bitmap.filtration(death);
+    if (b < d) diagrams[bitmap.dimension(birth)].emplace_back(b, d);
+  }
+  for (auto& diagram : diagrams) std::sort(diagram.begin(), diagram.end());
+  return diagrams;
+}
+
+Diagrams tiled_persistence(const std::vector<double>& data, std::size_t n_rows, std::size_t n_cols,
+                           std::size_t max_memory) {
+  Diagrams diagrams;
+  auto out = [&diagrams](int dim) {
+    return [&diagrams, dim](double b, double d) {
+      if (b < d) diagrams[dim].emplace_back(b, d);
+    };
+  };
+  double global_min = Gudhi::cubical_complex::persistence_on_rectangle_from_top_cells_tiled(
+      data.data(), n_rows, n_cols, out(0), out(1), max_memory);
+  diagrams[0].emplace_back(global_min, std::numeric_limits<double>::infinity());
+  for (auto& diagram : diagrams) std::sort(diagram.begin(), diagram.end());
+  return diagrams;
+}
+
+// Same with output_index = true, the indices being converted to values
+Diagrams tiled_persistence_by_index(const std::vector<double>& data, std::size_t n_rows, std::size_t n_cols,
+                                    std::size_t max_memory) {
+  Diagrams diagrams;
+  auto out = [&diagrams, &data](int dim) {
+    return [&diagrams, &data, dim](std::size_t b, std::size_t d) {
+      if (data[b] < data[d]) diagrams[dim].emplace_back(data[b], data[d]);
+    };
+  };
+  std::size_t global_min = Gudhi::cubical_complex::persistence_on_rectangle_from_top_cells_tiled<true>(
+      data.data(), n_rows, n_cols, out(0), out(1), max_memory);
+  diagrams[0].emplace_back(data[global_min], std::numeric_limits<double>::infinity());
+  for (auto& diagram : diagrams) std::sort(diagram.begin(), diagram.end());
+  return diagrams;
+}
+
+// A budget of 0 gives bands of one row, and the default one a single band
+void check_against_bitmap(const std::vector<double>& data, std::size_t n_rows, std::size_t n_cols,
+                          std::vector<std::size_t> const& budgets = {0, std::size_t(1) << 30}) {
+  Diagrams expected = bitmap_persistence(data, n_rows, n_cols);
+  for (std::size_t max_memory : budgets) {
+    BOOST_TEST_CONTEXT("shape " << n_rows << "x" << n_cols << ", max_memory " << max_memory) {
+      Diagrams diagrams = tiled_persistence(data, n_rows, n_cols, max_memory);
+      Diagrams diagrams_by_index = tiled_persistence_by_index(data, n_rows, n_cols, max_memory);
+      for (int dim = 0; dim < 2; ++dim) {
+        BOOST_TEST_CONTEXT("dimension " << dim) {
+          BOOST_CHECK(diagrams[dim] == expected[dim]);
+          BOOST_CHECK(diagrams_by_index[dim] == expected[dim]);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(persistence_on_rectangle_tiled_random) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<std::size_t> size(1, 12);
+  for (int i = 0; i < 200; ++i) {
+    std::size_t n_rows = size(gen), n_cols = size(gen);
+    // Few distinct values, for many ties
+    std::uniform_int_distribution<int> value(0, i % 2 == 0 ? 3 : 1000);
+    std::vector<double> data(n_rows * n_cols);
+    for (auto& x : data) x = value(gen);
+    check_against_bitmap(data, n_rows, n_cols);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(persistence_on_rectangle_tiled_band_sizes) {
+  // The size of the bands grows with the budget, from one row to the whole image
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> value(0, 20);
+  const std::size_t n_rows = 60, n_cols = 40;
+  std::vector<double> data(n_rows * n_cols);
+  for (auto& x : data) x = value(gen);
+  std::vector<std::size_t> budgets;
+  for (std::size_t max_memory = 0; max_memory < (std::size_t(1) << 19); max_memory += std::size_t(1) << 12)
+    budgets.push_back(max_memory);
+  check_against_bitmap(data, n_rows, n_cols, budgets);
+}
+
+BOOST_AUTO_TEST_CASE(persistence_on_rectangle_tiled_degenerate_shapes) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> value(0, 5);
+  std::vector<std::array<std::size_t, 2>> shapes{{1, 1}, {1, 2}, {2, 1}, {1, 9}, {9, 1},
+                                                 {2, 2}, {2, 9}, {9, 2}, {2, 30}, {30, 2}};
+  for (auto [n_rows, n_cols] : shapes) {
+    std::vector<double> data(n_rows * n_cols);
+    // Constant, increasing, decreasing and random values
+    std::fill(data.begin(), data.end(), 1.);
+    check_against_bitmap(data, n_rows, n_cols);
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = i;
+    check_against_bitmap(data, n_rows, n_cols);
+    for (std::size_t i = 0; i < data.size(); ++i) data[i] = -static_cast<double>(i);
+    check_against_bitmap(data, n_rows, n_cols);
+    for (auto& x : data) x = value(gen);
+    check_against_bitmap(data, n_rows, n_cols);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(persistence_on_rectangle_tiled_ring) {
+  // A ring of value 1 around a hole of value 3, on a background of value 2: the hole is a cycle of the ring that
+  // crosses all the bands of one row
+  const std::size_t n = 7;
+  std::vector<double> data(n * n, 2.);
+  for (std::size_t r = 1; r + 1 < n; ++r)
+    for (std::size_t c = 1; c + 1 < n; ++c) data[r * n + c] = (r == 1 || c == 1 || r + 2 == n || c + 2 == n) ? 1. : 3.;
+  Diagrams diagrams = tiled_persistence(data, n, n, 0);
+  BOOST_CHECK(diagrams[0] == (std::vector<std::pair<double, double>>{{1., std::numeric_limits<double>::infinity()}}));
+  BOOST_CHECK(diagrams[1] == (std::vector<std::pair<double, double>>{{1., 3.}}));
+  check_against_bitmap(data, n, n);
+}
@@ -29,6 +29,16 @@ struct SimplicialComplexForRips {
   template<class OneSkeletonGraph>
   void insert_graph(const OneSkeletonGraph& skel_graph);
 
+  /** \brief Optional. Inserts the given vertices with filtration value 0. If this method and `insert_batch_edges` are
+   * available, they are used instead of `insert_graph`, which saves the construction of the graph. */
+  template<class VertexRange>
+  void insert_batch_vertices(const VertexRange& vertices);
+
+  /** \brief Optional. Inserts the given edges, each of them a `std::tuple` of two vertices and a filtration value,
+   * sorted lexicographically. */
+  template<class EdgeRange>
+  void insert_batch_edges(const EdgeRange& edges);
+
   /** \brief Expands the simplicial complex containing only its one skeleton until a given maximal dimension as
    * explained in \ref ripsdefinition. */
   void expansion(int max_dim);
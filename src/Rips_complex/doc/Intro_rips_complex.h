@@ -101,6 +101,19 @@ namespace rips_complex {
  * number of higher-dimensional simplices may not be monotonous when
  * \f$\frac12\leq\epsilon\leq 1\f$.
  *
+ * \section incrementalrips Incremental Rips complex
+ *
+ * When no maximal edge length is known beforehand, `Gudhi::rips_complex::Incremental_rips_complex` sorts all the
+ * edges by length and inserts them on demand, with `Simplex_tree::insert_edge_as_flag`, in a simplex tree that is at
+ * any time the Rips complex for the length of the last inserted edge. The persistence can be computed at any of these
+ * checkpoints, and the construction stopped as soon as the diagram of interest does not change anymore.
+ *
+ * \section weightedrips Weighted Rips complex
+ *
+ * `Gudhi::rips_complex::Weighted_rips_complex` builds the weighted Rips filtration of \cite dtmfiltrations, where
+ * each point has a weight \f$w_i\f$, for instance its distance to measure. Vertex \f$i\f$ appears at \f$2w_i\f$ and
+ * edge \f$ij\f$ at \f$\max(2w_i, 2w_j, d(i,j) + w_i + w_j)\f$.
+ *
  * \section ripspointsdistance Point cloud and distance function
  * 
  * \subsection ripspointscloudexample Example from a point cloud and a distance function
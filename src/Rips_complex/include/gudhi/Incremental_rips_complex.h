@@ -0,0 +1,152 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef INCREMENTAL_RIPS_COMPLEX_H_
+#define INCREMENTAL_RIPS_COMPLEX_H_
+
+#include <gudhi/Rips_complex.h>
+
+#include <algorithm>  // for std::stable_sort
+#include <cstddef>  // for std::size_t
+#include <limits>  // for numeric_limits
+#include <tuple>
+#include <utility>  // for std::declval
+#include <vector>
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Incremental_rips_complex
+ * \brief Rips complex grown edge by edge, in increasing order of length, without any maximal edge length.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * All the edges are computed once, as in `Rips_complex` with an infinite threshold, and sorted by length. They are
+ * then inserted on demand in a simplicial complex owned by this class with `Simplex_tree::insert_edge_as_flag`, which
+ * only adds the simplices created by the new edge, up to the dimension given at construction. Between two calls, the
+ * complex is the Rips complex of the points for the current filtration value, and its persistence can be computed,
+ * for instance to stop as soon as a diagram stabilizes instead of choosing a threshold beforehand.
+ *
+ * The memory of the edges is quadratic in the number of points, but much smaller than the one of the full complex.
+ *
+ * \tparam SimplexTree must be a `Gudhi::Simplex_tree` with the `link_nodes_by_label` option, for instance
+ * `Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_full_featured>`.
+ */
+template <typename SimplexTree>
+class Incremental_rips_complex {
+  static_assert(SimplexTree::Options::link_nodes_by_label,
+                "Incremental_rips_complex requires the link_nodes_by_label option of the Simplex_tree.");
+
+ public:
+  using Filtration_value = typename SimplexTree::Filtration_value;
+  using Vertex_handle = typename SimplexTree::Vertex_handle;
+
+  /** \brief Incremental_rips_complex constructor from a list of points.
+   *
+   * The complex initially contains the vertices, with a 0 filtration value, and no edge.
+   *
+   * @param[in] points Range of points, as in the `Rips_complex` constructor.
+   * @param[in] distance Distance function, as in the `Rips_complex` constructor.
+   * @param[in] dim_max Maximal dimension of the complex. If set to -1, the expansion goes as far as possible.
+   */
+  template <typename ForwardPointRange, typename Distance>
+  Incremental_rips_complex(const ForwardPointRange& points, Distance distance, int dim_max)
+      : dim_max_(dim_max) {
+    Rips_complex<Filtration_value> rips(points, std::numeric_limits<Filtration_value>::infinity(), distance);
+    init(rips);
+  }
+
+  /** \brief Incremental_rips_complex constructor from a distance matrix.
+   *
+   * @param[in] distance_matrix Distance matrix, as in the `Rips_complex` constructor.
+   * @param[in] dim_max Maximal dimension of the complex. If set to -1, the expansion goes as far as possible.
+   */
+  template <typename DistanceMatrix>
+  Incremental_rips_complex(const DistanceMatrix& distance_matrix, int dim_max) : dim_max_(dim_max) {
+    Rips_complex<Filtration_value> rips(distance_matrix, std::numeric_limits<Filtration_value>::infinity());
+    init(rips);
+  }
+
+  /** \brief Returns the complex built so far. It must not be modified, but its persistence can be computed. */
+  SimplexTree& complex() { return complex_; }
+
+  /** \brief Inserts all the edges of length at most `max_length` that are not in the complex yet.
+   *
+   * @return The number of inserted edges.
+   */
+  std::size_t insert_edges_until(Filtration_value max_length) {
+    std::size_t end = next_edge_;
+    while (end < edges_.size() && std::get<2>(edges_[end]) <= max_length) ++end;
+    return insert_edges(end);
+  }
+
+  /** \brief Inserts the next `num_edges` edges, or all the remaining ones if there are fewer.
+   *
+   * The edges of the same length as the last inserted one may not all be inserted. Call `insert_edges_until` with
+   * `filtration()` to complete them, and get the Rips complex for this filtration value.
+   *
+   * @return The number of inserted edges.
+   */
+  std::size_t insert_next_edges(std::size_t num_edges) {
+    return insert_edges(next_edge_ + std::min(num_edges, edges_.size() - next_edge_));
+  }
+
+  /** \brief Returns the length of the last inserted edge, or 0 if no edge has been inserted. */
+  Filtration_value filtration() const { return next_edge_ == 0 ? 0 : std::get<2>(edges_[next_edge_ - 1]); }
+
+  /** \brief Returns the number of edges inserted in the complex. */
+  std::size_t num_inserted_edges() const { return next_edge_; }
+
+  /** \brief Returns the number of edges of the complete Rips graph. */
+  std::size_t num_edges() const { return edges_.size(); }
+
+  /** \brief Returns whether all the edges have been inserted. */
+  bool is_complete() const { return next_edge_ == edges_.size(); }
+
+ private:
+  void init(Rips_complex<Filtration_value>& rips) {
+    edges_ = rips.release_edges();
+    // Sorted lexicographically, so the ties are ordered deterministically
+    std::stable_sort(edges_.begin(), edges_.end(),
+                     [](auto const& a, auto const& b) { return std::get<2>(a) < std::get<2>(b); });
+    for (std::size_t v = 0; v < rips.num_vertices(); ++v)
+      complex_.insert_edge_as_flag(static_cast<Vertex_handle>(v), static_cast<Vertex_handle>(v), 0, dim_max_,
+                                   added_simplices_);
+    added_simplices_.clear();
+  }
+
+  std::size_t insert_edges(std::size_t end) {
+    const std::size_t first = next_edge_;
+    for (; next_edge_ < end; ++next_edge_) {
+      auto const& [u, v, fil] = edges_[next_edge_];
+      complex_.insert_edge_as_flag(u, v, fil, dim_max_, added_simplices_);
+      added_simplices_.clear();
+    }
+    // The filtration order cached by a previous persistence computation is obsolete
+    if (end > first) complex_.clear_filtration();
+    return end - first;
+  }
+
+  int dim_max_;
+  SimplexTree complex_;
+  // All the edges, sorted by length, and the first one not in the complex yet
+  decltype(std::declval<Rips_complex<Filtration_value>&>().release_edges()) edges_;
+  std::size_t next_edge_ = 0;
+  std::vector<typename SimplexTree::Simplex_handle> added_simplices_;
+};
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // INCREMENTAL_RIPS_COMPLEX_H_
@@ -13,8 +13,12 @@
 
 #include <gudhi/Debug_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
+#include <gudhi/distance_functions.h>
+#include <gudhi/Mapped_distance_matrix.h>
+#include <gudhi/Rips_complex/Proximity_edges.h>
 
 #include <boost/graph/adjacency_list.hpp>
+#include <boost/range/irange.hpp>
 
 #include <iostream>
 #include <vector>
@@ -22,12 +26,25 @@
 #include <string>
 #include <limits>  // for numeric_limits
 #include <utility>  // for pair<>
+#include <tuple>
+#include <type_traits>  // for std::is_same
 
 
 namespace Gudhi {
 
 namespace rips_complex {
 
+// Whether the complex can directly insert the vertices and the sorted edge list, without going through a graph.
+template <class Complex, class = void>
+struct Has_batch_insertion : std::false_type {};
+
+template <class Complex>
+struct Has_batch_insertion<
+    Complex, std::void_t<decltype(std::declval<Complex&>().insert_batch_vertices(boost::irange(0, 1))),
+                         decltype(std::declval<Complex&>().insert_batch_edges(
+                             std::vector<std::tuple<int, int, typename Complex::Filtration_value>>()))>>
+    : std::true_type {};
+
 /**
  * \class Rips_complex
  * \brief Rips complex data structure.
@@ -68,6 +85,13 @@ class Rips_complex {
    *
    * \tparam Distance furnishes `operator()(const Point& p1, const Point& p2)`, where
    * `Point` is a point from the `ForwardPointRange`, and that returns a `Filtration_value`.
+   *
+   * When `distance` is `Gudhi::Euclidean_distance`, the points are ranges of at most 3 coordinates and `threshold` is
+   * finite, the points are bucketed in a grid of cells of side `threshold`, and only the pairs of points in adjacent
+   * cells are tested, in parallel if Intel&reg; oneAPI TBB is available. Otherwise, for `float` or `double`
+   * coordinates, all the pairs are tested, but the distances are computed by blocks with
+   * `Gudhi::Blocked_euclidean_distance`, also in parallel. In both cases, the graph is the same as with any other
+   * functor computing the Euclidean distance.
    */
   template<typename ForwardPointRange, typename Distance >
   Rips_complex(const ForwardPointRange& points, Filtration_value threshold, Distance distance) {
@@ -90,6 +114,28 @@ class Rips_complex {
                             [&](size_t i, size_t j){return distance_matrix[j][i];});
   }
 
+  /** \brief Rips_complex constructor from a distance matrix file mapped in memory.
+   *
+   * @param[in] distance_matrix Condensed distance matrix.
+   * @param[in] threshold Maximal edge length. All edges of the graph strictly greater than `threshold` are not
+   * inserted in the graph.
+   *
+   * The file is read once, row by row, and only the edges of length at most `threshold` are stored, so that the
+   * memory used is proportional to the number of edges of the graph, not to the size of the matrix.
+   */
+  template<typename T>
+  Rips_complex(const Mapped_condensed_distance_matrix<T>& distance_matrix, Filtration_value threshold) {
+    edges_.clear();
+    const std::size_t n = distance_matrix.size();
+    distance_matrix.for_each_row([&](std::size_t i, const T* row) {
+      for (std::size_t k = 0; k < n - i - 1; ++k) {
+        Filtration_value fil = row[k];
+        if (fil <= threshold) edges_.emplace_back(i, i + 1 + k, fil);
+      }
+    });
+    num_vertices_ = n;
+  }
+
   /** \brief Initializes the simplicial complex from the Rips graph and expands it until a given maximal
    * dimension.
    *
@@ -106,11 +152,45 @@ class Rips_complex {
                 std::invalid_argument("Rips_complex::create_complex - simplicial complex is not empty"));
 
     // insert the proximity graph in the simplicial complex
-    complex.insert_graph(rips_skeleton_graph_);
+    if constexpr (Has_batch_insertion<SimplicialComplexForRips>::value) {
+      complex.insert_batch_vertices(boost::irange(static_cast<Vertex_handle>(0), num_vertices_));
+      complex.insert_batch_edges(edges_);
+    } else {
+      std::vector<std::pair<Vertex_handle, Vertex_handle>> edges;
+      std::vector<Filtration_value> edges_fil;
+      edges.reserve(edges_.size());
+      edges_fil.reserve(edges_.size());
+      for (auto& e : edges_) {
+        edges.emplace_back(std::get<0>(e), std::get<1>(e));
+        edges_fil.push_back(std::get<2>(e));
+      }
+      OneSkeletonGraph skel_graph(edges.begin(), edges.end(), edges_fil.begin(), num_vertices_);
+      auto vertex_prop = boost::get(vertex_filtration_t(), skel_graph);
+      using vertex_iterator = typename boost::graph_traits<OneSkeletonGraph>::vertex_iterator;
+      vertex_iterator vi, vi_end;
+      for (std::tie(vi, vi_end) = boost::vertices(skel_graph); vi != vi_end; ++vi) {
+        boost::put(vertex_prop, *vi, 0.);
+      }
+      complex.insert_graph(skel_graph);
+    }
     // expand the graph until dimension dim_max
     complex.expansion(dim_max);
   }
 
+  /** \brief Returns the number of vertices of the Rips graph. */
+  std::size_t num_vertices() const { return num_vertices_; }
+
+  /** \brief Returns the number of edges of the Rips graph. */
+  std::size_t num_edges() const { return edges_.size(); }
+
+  /** \brief Moves out the edges of the Rips graph, as `std::tuple<int, int, Filtration_value>` sorted
+   * lexicographically, for instance to pass them to `Gudhi::collapse::flag_complex_collapse_edges` without a copy.
+   * The Rips graph keeps its vertices but has no edge anymore.
+   */
+  std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>> release_edges() {
+    return std::exchange(edges_, {});
+  }
+
  private:
   /** \brief Computes the proximity graph of the points.
    *
@@ -126,47 +206,53 @@ class Rips_complex {
   template< typename ForwardPointRange, typename Distance >
   void compute_proximity_graph(const ForwardPointRange& points, Filtration_value threshold,
                Distance distance) {
-    std::vector< std::pair< Vertex_handle, Vertex_handle > > edges;
-    std::vector< Filtration_value > edges_fil;
+    edges_.clear();
 
     // Compute the proximity graph of the points.
     // If points contains n elements, the proximity graph is the graph with n vertices, and an edge [u,v] iff the
     // distance function between points u and v is smaller than threshold.
     // --------------------------------------------------------------------------------------------
-    // Creates the vector of edges and its filtration values (returned by distance function)
+    // Creates the vector of edges with their filtration values (returned by distance function)
+    // Number of points is labeled from 0 to idx_u-1
     Vertex_handle idx_u = 0;
-    for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
-      Vertex_handle idx_v = idx_u + 1;
-      for (auto it_v = it_u + 1; it_v != std::end(points); ++it_v, ++idx_v) {
-        Filtration_value fil = distance(*it_u, *it_v);
-        if (fil <= threshold) {
-          edges.emplace_back(idx_u, idx_v);
-          edges_fil.push_back(fil);
-        }
+    using Point = std::decay_t<decltype(*std::begin(points))>;
+    bool edges_computed = false;
+    if constexpr (std::is_same<Distance, Euclidean_distance>::value && Has_arithmetic_coordinates<Point>::value) {
+      // Only close points are tested
+      std::vector<decltype(std::begin(points))> point_iterators;
+      for (auto it = std::begin(points); it != std::end(points); ++it) point_iterators.push_back(it);
+      if (grid_proximity_edges(point_iterators, threshold, distance, edges_)) {
+        idx_u = point_iterators.size();
+        edges_computed = true;
       }
     }
-
-    // --------------------------------------------------------------------------------------------
-    // Creates the proximity graph from edges and sets the property with the filtration value.
-    // Number of points is labeled from 0 to idx_u-1
-    // --------------------------------------------------------------------------------------------
-    // Do not use : rips_skeleton_graph_ = OneSkeletonGraph(...) -> deep copy of the graph (boost graph is not
-    // move-enabled)
-    rips_skeleton_graph_.~OneSkeletonGraph();
-    new(&rips_skeleton_graph_)OneSkeletonGraph(edges.begin(), edges.end(), edges_fil.begin(), idx_u);
-
-    auto vertex_prop = boost::get(vertex_filtration_t(), rips_skeleton_graph_);
-
-    using vertex_iterator = typename boost::graph_traits<OneSkeletonGraph>::vertex_iterator;
-    vertex_iterator vi, vi_end;
-    for (std::tie(vi, vi_end) = boost::vertices(rips_skeleton_graph_);
-         vi != vi_end; ++vi) {
-      boost::put(vertex_prop, *vi, 0.);
+    if constexpr (std::is_same<Distance, Euclidean_distance>::value && Has_floating_point_coordinates<Point>::value) {
+      // All pairs, but many at once
+      if (!edges_computed) {
+        using Coordinate = typename Has_floating_point_coordinates<Point>::Coordinate;
+        Blocked_euclidean_distance<Coordinate> blocked_distance(points);
+        blocked_proximity_edges(blocked_distance, threshold, edges_);
+        idx_u = blocked_distance.size();
+        edges_computed = true;
+      }
+    }
+    if (!edges_computed) {
+      for (auto it_u = std::begin(points); it_u != std::end(points); ++it_u, ++idx_u) {
+        Vertex_handle idx_v = idx_u + 1;
+        for (auto it_v = it_u + 1; it_v != std::end(points); ++it_v, ++idx_v) {
+          Filtration_value fil = distance(*it_u, *it_v);
+          if (fil <= threshold) edges_.emplace_back(idx_u, idx_v, fil);
+        }
+      }
     }
+    num_vertices_ = idx_u;
   }
 
  private:
-  OneSkeletonGraph rips_skeleton_graph_;
+  // Edges of the Rips graph, sorted lexicographically, and number of vertices. A boost::adjacency_list is only built
+  // in create_complex, when the complex cannot insert edges in batch.
+  std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>> edges_;
+  Vertex_handle num_vertices_ = 0;
 };
 
 }  // namespace rips_complex
@@ -0,0 +1,213 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef RIPS_COMPLEX_PROXIMITY_EDGES_H_
+#define RIPS_COMPLEX_PROXIMITY_EDGES_H_
+
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
+#include <gudhi/distance_functions.h>
+
+#include <vector>
+#include <tuple>
+#include <iterator>  // for std::begin, std::distance
+#include <algorithm>  // for std::sort, std::lower_bound, std::lexicographical_compare
+#include <cmath>  // for std::floor, std::isfinite
+#include <cstdint>  // for std::int64_t
+#include <type_traits>
+#include <utility>  // for std::declval
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/** \private
+ * Tells if Point is a range of arithmetic coordinates.
+ */
+template <class Point, class = void>
+struct Has_arithmetic_coordinates : std::false_type {};
+
+template <class Point>
+struct Has_arithmetic_coordinates<Point, std::void_t<decltype(std::end(std::declval<const Point&>()))>>
+    : std::is_arithmetic<std::decay_t<decltype(*std::begin(std::declval<const Point&>()))>> {};
+
+/** \private
+ * \brief Computes the pairs of points at distance at most `threshold`, for a distance bounded from below by the
+ * differences of coordinates (like the Euclidean one), without testing all the pairs.
+ *
+ * The points are bucketed in a uniform grid of cells of side `threshold`, and only the pairs of points in the same or
+ * in adjacent cells are tested with `distance`. With TBB, the cells are processed in parallel.
+ * The edges are output sorted by vertices, as in the quadratic loop, with the same filtration values.
+ *
+ * \return false, and leaves `edges` untouched, when a grid does not help: `threshold` is not finite or not positive,
+ * the points do not all have the same dimension, or it is larger than `max_dimension` (there are 3^dimension
+ * adjacent cells).
+ */
+template <class Vertex_handle, class Filtration_value, class PointIterator, class Distance>
+bool grid_proximity_edges(const std::vector<PointIterator>& points, Filtration_value threshold, Distance distance,
+                          std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>>& edges,
+                          int max_dimension = 3) {
+  using Edge = std::tuple<Vertex_handle, Vertex_handle, Filtration_value>;
+  const std::size_t n = points.size();
+  if (n < 2 || !(threshold > 0) || !std::isfinite(static_cast<double>(threshold))) return false;
+  const std::size_t dim = std::distance(std::begin(*points[0]), std::end(*points[0]));
+  if (dim == 0 || dim > static_cast<std::size_t>(max_dimension)) return false;
+
+  std::vector<double> mins(std::begin(*points[0]), std::end(*points[0]));
+  for (auto p : points) {
+    if (static_cast<std::size_t>(std::distance(std::begin(*p), std::end(*p))) != dim) return false;
+    std::size_t k = 0;
+    for (auto x : *p) {
+      mins[k] = std::min<double>(mins[k], x);
+      ++k;
+    }
+  }
+
+  // Slightly larger cells, so that rounding errors cannot separate two points at distance threshold by more than one
+  // cell.
+  const double side = static_cast<double>(threshold) * (1 + 1e-6);
+  std::vector<std::int64_t> cell_of_point(n * dim);
+  for (std::size_t i = 0; i < n; ++i) {
+    std::size_t k = 0;
+    for (auto x : *points[i]) {
+      double c = std::floor((x - mins[k]) / side);
+      if (!(c < 1e15)) return false;  // far too many cells, or NaN
+      cell_of_point[i * dim + k] = static_cast<std::int64_t>(c);
+      ++k;
+    }
+  }
+  auto cell = [&](std::size_t i) { return cell_of_point.begin() + i * dim; };
+
+  // Points sorted by cell, and first point of each cell in this order
+  std::vector<Vertex_handle> sorted_points(n);
+  for (std::size_t i = 0; i < n; ++i) sorted_points[i] = static_cast<Vertex_handle>(i);
+  std::sort(sorted_points.begin(), sorted_points.end(), [&](Vertex_handle a, Vertex_handle b) {
+    return std::lexicographical_compare(cell(a), cell(a) + dim, cell(b), cell(b) + dim);
+  });
+  std::vector<std::size_t> cell_begin{0};
+  for (std::size_t i = 1; i < n; ++i)
+    if (!std::equal(cell(sorted_points[i - 1]), cell(sorted_points[i - 1]) + dim, cell(sorted_points[i])))
+      cell_begin.push_back(i);
+  const std::size_t num_cells = cell_begin.size();
+  cell_begin.push_back(n);
+
+  std::size_t num_offsets = 1;
+  for (std::size_t k = 0; k < dim; ++k) num_offsets *= 3;
+
+  // Tests the pairs between the cell c and the adjacent cells that come after it in the lexicographic order.
+  auto process_cell = [&](std::size_t c, std::vector<Edge>& out) {
+    std::vector<std::int64_t> neighbor_cell(dim);
+    auto key = cell(sorted_points[cell_begin[c]]);
+    for (std::size_t offset = 0; offset < num_offsets; ++offset) {
+      std::size_t o = offset;
+      for (std::size_t k = 0; k < dim; ++k, o /= 3) neighbor_cell[k] = key[k] + static_cast<std::int64_t>(o % 3) - 1;
+      if (std::lexicographical_compare(neighbor_cell.begin(), neighbor_cell.end(), key, key + dim)) continue;
+      // binary search of the neighbor cell among the non empty cells after c
+      auto it = std::lower_bound(cell_begin.begin() + c, cell_begin.begin() + num_cells, neighbor_cell,
+                                 [&](std::size_t first, const std::vector<std::int64_t>& nc) {
+                                   auto k1 = cell(sorted_points[first]);
+                                   return std::lexicographical_compare(k1, k1 + dim, nc.begin(), nc.end());
+                                 });
+      if (it == cell_begin.begin() + num_cells ||
+          !std::equal(neighbor_cell.begin(), neighbor_cell.end(), cell(sorted_points[*it])))
+        continue;
+      const std::size_t nc = it - cell_begin.begin();
+      for (std::size_t i = cell_begin[c]; i < cell_begin[c + 1]; ++i) {
+        for (std::size_t j = (nc == c ? i + 1 : cell_begin[nc]); j < cell_begin[nc + 1]; ++j) {
+          Vertex_handle u = std::min(sorted_points[i], sorted_points[j]);
+          Vertex_handle v = std::max(sorted_points[i], sorted_points[j]);
+          Filtration_value fil = distance(*points[u], *points[v]);
+          if (fil <= threshold) out.emplace_back(u, v, fil);
+        }
+      }
+    }
+  };
+
+#ifdef GUDHI_USE_TBB
+  tbb::enumerable_thread_specific<std::vector<Edge>> local_edges;
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_cells), [&](const tbb::blocked_range<std::size_t>& r) {
+    auto& out = local_edges.local();
+    for (std::size_t c = r.begin(); c != r.end(); ++c) process_cell(c, out);
+  });
+  edges.clear();
+  for (auto& out : local_edges) edges.insert(edges.end(), out.begin(), out.end());
+#else
+  edges.clear();
+  for (std::size_t c = 0; c < num_cells; ++c) process_cell(c, edges);
+#endif
+  std::sort(edges.begin(), edges.end(), [](const Edge& a, const Edge& b) {
+    return std::get<0>(a) < std::get<0>(b) || (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) < std::get<1>(b));
+  });
+  return true;
+}
+
+/** \private
+ * \brief Computes the pairs of points at Euclidean distance at most `threshold` with `Gudhi::Blocked_euclidean_distance`,
+ * which gives the same distances as `Gudhi::Euclidean_distance`. With TBB, the rows of the distance matrix are
+ * processed in parallel, by tiles. The edges are output sorted by vertices, as in the quadratic loop.
+ */
+template <class Vertex_handle, class Filtration_value, class T>
+void blocked_proximity_edges(const Blocked_euclidean_distance<T>& distance, Filtration_value threshold,
+                             std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>>& edges) {
+  using Edge = std::tuple<Vertex_handle, Vertex_handle, Filtration_value>;
+  const std::size_t n = distance.size();
+  // The distance matrix is computed by tiles of tile_rows x tile_columns, so that each block of points is reused for
+  // several rows while it is in the cache.
+  constexpr std::size_t tile_rows = 32;
+  constexpr std::size_t tile_columns = 4096;
+  const std::size_t num_tiles = (n + tile_rows - 1) / tile_rows;
+  auto lexicographic = [](const Edge& a, const Edge& b) {
+    return std::get<0>(a) < std::get<0>(b) || (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) < std::get<1>(b));
+  };
+  auto process_rows = [&](std::size_t tile, std::vector<T>& tile_distances, std::vector<Edge>& out) {
+    const std::size_t first_edge = out.size();
+    const std::size_t first_row = tile * tile_rows;
+    const std::size_t last_row = std::min(first_row + tile_rows, n);
+    for (std::size_t first = first_row + 1; first < n; first += tile_columns) {
+      const std::size_t last = std::min(first + tile_columns, n);
+      tile_distances.resize((last_row - first_row) * (last - first));
+      distance.distances(first_row, last_row, first, last, tile_distances.data());
+      for (std::size_t i = first_row; i < last_row; ++i) {
+        const T* row = tile_distances.data() + (i - first_row) * (last - first);
+        for (std::size_t j = std::max(first, i + 1); j < last; ++j) {
+          Filtration_value fil = row[j - first];
+          if (fil <= threshold) out.emplace_back(static_cast<Vertex_handle>(i), static_cast<Vertex_handle>(j), fil);
+        }
+      }
+    }
+    // The edges of a tile are found column chunk by column chunk
+    std::sort(out.begin() + first_edge, out.end(), lexicographic);
+  };
+
+  edges.clear();
+#ifdef GUDHI_USE_TBB
+  tbb::enumerable_thread_specific<std::pair<std::vector<T>, std::vector<Edge>>> local;
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_tiles), [&](const tbb::blocked_range<std::size_t>& r) {
+    auto& [tile_distances, out] = local.local();
+    for (std::size_t tile = r.begin(); tile != r.end(); ++tile) process_rows(tile, tile_distances, out);
+  });
+  for (auto& [tile_distances, out] : local) edges.insert(edges.end(), out.begin(), out.end());
+  // Each thread processed an arbitrary subset of the tiles
+  std::sort(edges.begin(), edges.end(), lexicographic);
+#else
+  std::vector<T> tile_distances;
+  for (std::size_t tile = 0; tile < num_tiles; ++tile) process_rows(tile, tile_distances, edges);
+#endif
+}
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // RIPS_COMPLEX_PROXIMITY_EDGES_H_
@@ -14,12 +14,23 @@
 #include <gudhi/Debug_utils.h>
 #include <gudhi/graph_simplicial_complex.h>
 #include <gudhi/choose_n_farthest_points.h>
+#include <gudhi/distance_functions.h>
 
 #include <boost/graph/graph_traits.hpp>
 #include <boost/range/metafunctions.hpp>
+#include <boost/range/adaptor/transformed.hpp>
 #include <boost/iterator/counting_iterator.hpp>
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#endif
+
 #include <vector>
+#include <tuple>
+#include <utility>  // for std::pair
+#include <type_traits>  // for std::is_same, std::decay
 
 namespace Gudhi {
 namespace rips_complex {
@@ -103,7 +114,6 @@ namespace rips_complex {
 template <typename Filtration_value>
 class Sparse_rips_complex {
  private:
-  // TODO(MG): use a different graph where we know we can safely insert in parallel.
   typedef int Vertex_handle;
   typedef rips_complex::Graph<Vertex_handle, Filtration_value> Graph;
 
@@ -116,16 +126,34 @@ class Sparse_rips_complex {
    * @param[in] mini Minimal filtration value. Ignore anything below this scale. This is a less efficient version of `Gudhi::subsampling::sparsify_point_set()`.
    * @param[in] maxi Maximal filtration value. Ignore anything above this scale.
    *
+   * When `distance` is `Gudhi::Euclidean_distance` and the points are ranges of `float` or `double` coordinates, the
+   * distances used to build the sparse graph are computed by blocks with `Gudhi::Blocked_euclidean_distance`.
+   *
+   * If Intel&reg; oneAPI TBB is available and `Gudhi::Is_thread_safe_distance<Distance>` is true (for instance for
+   * `Gudhi::Euclidean_distance`), the farthest point ordering and the construction of the sparse graph are parallel,
+   * and `distance` is called concurrently from several threads. Otherwise, they are sequential.
    */
   template <typename RandomAccessPointRange, typename Distance>
   Sparse_rips_complex(const RandomAccessPointRange& points, Distance distance, double const epsilon, Filtration_value const mini=-std::numeric_limits<Filtration_value>::infinity(), Filtration_value const maxi=std::numeric_limits<Filtration_value>::infinity())
       : epsilon_(epsilon) {
     GUDHI_CHECK(epsilon > 0, "epsilon must be positive");
-    auto dist_fun = [&](Vertex_handle i, Vertex_handle j) { return distance(points[i], points[j]); };
+    Indexed_distance<RandomAccessPointRange, Distance> dist_fun{points, distance};
     // TODO: stop choose_n_farthest_points once it reaches mini or 0?
     subsampling::choose_n_farthest_points_metric(dist_fun, boost::irange<Vertex_handle>(0, boost::size(points)), -1, -1,
                                                  std::back_inserter(sorted_points), std::back_inserter(params));
-    compute_sparse_graph(dist_fun, epsilon, mini, maxi);
+    using Point = std::decay_t<decltype(points[0])>;
+    if constexpr (std::is_same<Distance, Euclidean_distance>::value && Has_floating_point_coordinates<Point>::value) {
+      // Copy of the points in the farthest point order, so that the distances from a point to the following ones are
+      // computed at once.
+      using Coordinate = typename Has_floating_point_coordinates<Point>::Coordinate;
+      Blocked_euclidean_distance<Coordinate> sorted_distance(
+          boost::adaptors::transform(sorted_points, [&](Vertex_handle i) -> const Point& { return points[i]; }));
+      compute_sparse_graph_from_rows<Coordinate, Is_thread_safe_distance<Distance>::value>(
+          [&](std::size_t i, std::size_t n, Coordinate* out) { sorted_distance.distances(i, i + 1, n, out); },
+          epsilon, mini, maxi);
+    } else {
+      compute_sparse_graph(dist_fun, epsilon, mini, maxi);
+    }
   }
 
   /** \brief Sparse_rips_complex constructor from a distance matrix.
@@ -137,11 +165,14 @@ class Sparse_rips_complex {
    * @param[in] epsilon Approximation parameter. epsilon must be positive.
    * @param[in] mini Minimal filtration value. Ignore anything below this scale. This is a less efficient version of `Gudhi::subsampling::sparsify_point_set()`.
    * @param[in] maxi Maximal filtration value. Ignore anything above this scale.
+   *
+   * If Intel&reg; oneAPI TBB is available, the farthest point ordering and the construction of the sparse graph are
+   * parallel, and `distance_matrix` is read concurrently from several threads.
    */
   template <typename DistanceMatrix>
   Sparse_rips_complex(const DistanceMatrix& distance_matrix, double const epsilon, Filtration_value const mini=-std::numeric_limits<Filtration_value>::infinity(), Filtration_value const maxi=std::numeric_limits<Filtration_value>::infinity())
       : Sparse_rips_complex(boost::irange<Vertex_handle>(0, boost::size(distance_matrix)),
-                            [&](Vertex_handle i, Vertex_handle j) { return (i==j) ? 0 : (i<j) ? distance_matrix[j][i] : distance_matrix[i][j]; },
+                            Matrix_distance<DistanceMatrix>{distance_matrix},
                             epsilon, mini, maxi) {}
 
   /** \brief Fills the simplicial complex with the sparse Rips graph and
@@ -183,9 +214,41 @@ class Sparse_rips_complex {
   }
 
  private:
+  // Distance between the points of given indices. It may be called concurrently if the distance on points may.
+  template <typename RandomAccessPointRange, typename Distance>
+  struct Indexed_distance {
+    static constexpr bool is_thread_safe = Is_thread_safe_distance<Distance>::value;
+    const RandomAccessPointRange& points;
+    Distance& distance;
+    auto operator()(Vertex_handle i, Vertex_handle j) const { return distance(points[i], points[j]); }
+  };
+
+  // Distance read in the lower triangle of a distance matrix, which only reads the matrix.
+  template <typename DistanceMatrix>
+  struct Matrix_distance {
+    static constexpr bool is_thread_safe = true;
+    const DistanceMatrix& distance_matrix;
+    auto operator()(Vertex_handle i, Vertex_handle j) const {
+      return (i == j) ? 0 : (i < j) ? distance_matrix[j][i] : distance_matrix[i][j];
+    }
+  };
+
   // PointRange must be random access.
   template <typename Distance>
   void compute_sparse_graph(Distance& dist, double const epsilon, Filtration_value const mini, Filtration_value const maxi) {
+    using Distance_value = std::decay_t<decltype(dist(sorted_points[0], sorted_points[0]))>;
+    compute_sparse_graph_from_rows<Distance_value, Is_thread_safe_distance<Distance>::value>(
+        [&](std::size_t i, std::size_t n, Distance_value* out) {
+          for (std::size_t j = i + 1; j < n; ++j) out[j - i - 1] = dist(sorted_points[i], sorted_points[j]);
+        },
+        epsilon, mini, maxi);
+  }
+
+  // row_distances(i, n, out) writes in out[j - i - 1] the distance between the i-th and the j-th points in the farthest
+  // point order, for i < j < n. The rows are handled in parallel if `parallel` is true and TBB is available.
+  template <typename Distance_value, bool parallel, typename Row_distances>
+  void compute_sparse_graph_from_rows(Row_distances&& row_distances, double const epsilon, Filtration_value const mini,
+                                      Filtration_value const maxi) {
     const auto& points = sorted_points; // convenience alias
     std::size_t n = boost::size(points);
     double cst = epsilon * (1 - epsilon) / 2;
@@ -201,17 +264,18 @@ class Sparse_rips_complex {
     n = num_vertices(graph_);
 
     // TODO(MG):
-    // - make it parallel
     // - only test near-enough neighbors
-    for (std::size_t i = 0; i < n; ++i) {
+    auto process_row = [&](std::size_t i, std::vector<Distance_value>& row, typename Graph::EList& out) {
       auto&& pi = points[i];
       auto li = params[i];
       // If we inserted all the points, points with multiplicity would get connected to their first representative,
       // no need to handle the redundant ones in the outer loop.
       // if (li <= 0 && i != 0) break;
+      row.resize(n - i - 1);
+      row_distances(i, n, row.data());
       for (std::size_t j = i + 1; j < n; ++j) {
         auto&& pj = points[j];
-        auto d = dist(pi, pj);
+        auto d = row[j - i - 1];
         auto lj = params[j];
         GUDHI_CHECK(lj <= li, "Bad furthest point sorting");
         Filtration_value alpha;
@@ -229,9 +293,23 @@ class Sparse_rips_complex {
         }
 
         if (alpha <= maxi)
-          add_edge(pi, pj, alpha, graph_);
+          out.emplace_back(pi, pj, alpha);
       }
+    };
+#ifdef GUDHI_USE_TBB
+    if constexpr (parallel) {
+      // Rows in parallel, each thread with its own buffers. The order of the edges in the graph does not matter.
+      tbb::enumerable_thread_specific<std::pair<std::vector<Distance_value>, typename Graph::EList>> local;
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n), [&](const tbb::blocked_range<std::size_t>& r) {
+        auto& [row, out] = local.local();
+        for (std::size_t i = r.begin(); i != r.end(); ++i) process_row(i, row, out);
+      });
+      for (auto& [row, out] : local) graph_.elist.insert(graph_.elist.end(), out.begin(), out.end());
+      return;
     }
+#endif
+    std::vector<Distance_value> row;
+    for (std::size_t i = 0; i < n; ++i) process_row(i, row, graph_.elist);
   }
 
   Graph graph_;
@@ -0,0 +1,142 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef WEIGHTED_RIPS_COMPLEX_H_
+#define WEIGHTED_RIPS_COMPLEX_H_
+
+#include <gudhi/Debug_utils.h>
+#include <gudhi/Rips_complex.h>
+
+#include <algorithm>  // for std::max, std::min_element
+#include <cmath>  // for std::abs
+#include <cstddef>  // for std::size_t
+#include <iterator>  // for std::begin, std::end
+#include <limits>  // for numeric_limits
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace Gudhi {
+
+namespace rips_complex {
+
+/**
+ * \class Weighted_rips_complex
+ * \brief Weighted Rips complex, as defined in \cite dtmfiltrations with \f$p=1\f$, for instance with the distance to
+ * measure as weights.
+ *
+ * \ingroup rips_complex
+ *
+ * \details
+ * The filtration value of vertex \f$i\f$ is \f$2w_i\f$, and the one of edge \f$ij\f$ is
+ * \f$\max(2w_i, 2w_j, d(i,j) + w_i + w_j)\f$. As for `Rips_complex`, all the filtration values are doubled compared
+ * to the definition of the paper. The simplices of filtration value greater than a threshold are not inserted.
+ *
+ * Since \f$d(i,j) + w_i + w_j \geq d(i,j) + 2\min_k w_k\f$, the edges are first computed as the ones of a
+ * `Rips_complex` of threshold \f$threshold - 2\min_k w_k\f$, with the same fast paths for Euclidean points, and only
+ * those are weighted.
+ *
+ * \tparam Filtration_value is the type used to store the filtration values of the simplicial complex.
+ */
+template <typename Filtration_value>
+class Weighted_rips_complex {
+ private:
+  typedef int Vertex_handle;
+
+ public:
+  /** \brief Weighted_rips_complex constructor from a list of points.
+   *
+   * @param[in] points Range of points.
+   * @param[in] weights Range of the weights \f$w_i\f$ of the points, in the same order.
+   * @param[in] threshold Maximal filtration value.
+   * @param[in] distance Distance function, as in the `Rips_complex` constructor.
+   * @exception std::invalid_argument If the number of weights is not the number of points.
+   */
+  template <typename ForwardPointRange, typename WeightRange, typename Distance>
+  Weighted_rips_complex(const ForwardPointRange& points, const WeightRange& weights, Filtration_value threshold,
+                        Distance distance)
+      : weights_(std::begin(weights), std::end(weights)) {
+    Rips_complex<Filtration_value> rips(points, edge_threshold(threshold), distance);
+    compute_weighted_graph(rips, threshold);
+  }
+
+  /** \brief Weighted_rips_complex constructor from a distance matrix.
+   *
+   * @param[in] distance_matrix Range of range of distances, as in the `Rips_complex` constructor. `distance_matrix[i][j]`
+   * is only read for \f$j < i\f$.
+   * @param[in] weights Range of the weights \f$w_i\f$ of the points.
+   * @param[in] threshold Maximal filtration value.
+   * @exception std::invalid_argument If the number of weights is not the size of the matrix.
+   */
+  template <typename DistanceMatrix, typename WeightRange>
+  Weighted_rips_complex(const DistanceMatrix& distance_matrix, const WeightRange& weights, Filtration_value threshold)
+      : weights_(std::begin(weights), std::end(weights)) {
+    Rips_complex<Filtration_value> rips(distance_matrix, edge_threshold(threshold));
+    compute_weighted_graph(rips, threshold);
+  }
+
+  /** \brief Initializes the simplicial complex from the weighted Rips graph and expands it until a given maximal
+   * dimension.
+   *
+   * \tparam SimplexTree must be a `Gudhi::Simplex_tree`, or provide the same `insert_batch_vertices`,
+   * `insert_batch_edges`, `skeleton_simplex_range`, `assign_filtration` and `expansion` methods.
+   *
+   * @param[in] complex SimplexTree to be created.
+   * @param[in] dim_max graph expansion until this given maximal dimension.
+   * @exception std::invalid_argument In debug mode, if `complex.num_vertices()` does not return 0.
+   */
+  template <typename SimplexTree>
+  void create_complex(SimplexTree& complex, int dim_max) {
+    GUDHI_CHECK(complex.num_vertices() == 0,
+                std::invalid_argument("Weighted_rips_complex::create_complex - simplicial complex is not empty"));
+    complex.insert_batch_vertices(vertices_);
+    // The vertices are visited by increasing label, like vertices_
+    auto fil_it = vertex_filtrations_.begin();
+    for (auto sh : complex.skeleton_simplex_range(0)) complex.assign_filtration(sh, *fil_it++);
+    complex.insert_batch_edges(edges_);
+    complex.expansion(dim_max);
+  }
+
+ private:
+  Filtration_value edge_threshold(Filtration_value threshold) const {
+    if (weights_.empty()) return threshold;
+    Filtration_value min_weight = *std::min_element(weights_.begin(), weights_.end());
+    Filtration_value edge_threshold = threshold - 2 * min_weight;
+    // Margin for the rounding of d + w_i + w_j, the exact test is done afterwards
+    return edge_threshold + std::abs(edge_threshold) * 8 * std::numeric_limits<Filtration_value>::epsilon();
+  }
+
+  void compute_weighted_graph(Rips_complex<Filtration_value>& rips, Filtration_value threshold) {
+    if (weights_.size() != rips.num_vertices())
+      throw std::invalid_argument("Weighted_rips_complex - there must be one weight per point");
+    for (std::size_t i = 0; i < weights_.size(); ++i) {
+      if (2 * weights_[i] <= threshold) {
+        vertices_.push_back(static_cast<Vertex_handle>(i));
+        vertex_filtrations_.push_back(2 * weights_[i]);
+      }
+    }
+    // Still sorted lexicographically
+    for (auto const& [u, v, d] : rips.release_edges()) {
+      Filtration_value fil = std::max({2 * weights_[u], 2 * weights_[v], d + weights_[v] + weights_[u]});
+      if (fil <= threshold) edges_.emplace_back(u, v, fil);
+    }
+  }
+
+  std::vector<Filtration_value> weights_;
+  std::vector<Vertex_handle> vertices_;
+  std::vector<Filtration_value> vertex_filtrations_;
+  std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>> edges_;
+};
+
+}  // namespace rips_complex
+
+}  // namespace Gudhi
+
+#endif  // WEIGHTED_RIPS_COMPLEX_H_
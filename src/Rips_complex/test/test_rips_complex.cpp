@@ -17,14 +17,22 @@
 #include <string>
 #include <vector>
 #include <algorithm>    // std::max
+#include <array>
+#include <random>
+#include <thread>  // for std::this_thread
+#include <functional>  // for std::ref
 
 #include <gudhi/Rips_complex.h>
 #include <gudhi/Sparse_rips_complex.h>
+#include <gudhi/Incremental_rips_complex.h>
+#include <gudhi/Weighted_rips_complex.h>
+#include <gudhi/Persistent_cohomology.h>
 // to construct Rips_complex from a OFF file of points
 #include <gudhi/Points_off_io.h>
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/distance_functions.h>
 #include <gudhi/reader_utils.h>
+#include <gudhi/Mapped_distance_matrix.h>
 #include <gudhi/Unitary_tests_utils.h>
 
 // Type definitions
@@ -403,3 +411,273 @@ BOOST_AUTO_TEST_CASE(Rips_create_complex_throw) {
   BOOST_CHECK_THROW (rips_complex_from_file.create_complex(stree, 1), std::invalid_argument);
 }
 #endif
+
+template <class PointRange>
+void test_grid_against_all_pairs(const PointRange& points, Filtration_value threshold) {
+  // Rips_complex only uses the grid for Gudhi::Euclidean_distance, not for another functor
+  Rips_complex rips_with_grid(points, threshold, Gudhi::Euclidean_distance());
+  Rips_complex rips_all_pairs(points, threshold,
+                              [](const auto& p1, const auto& p2) { return Gudhi::Euclidean_distance()(p1, p2); });
+  Simplex_tree st_with_grid, st_all_pairs;
+  rips_with_grid.create_complex(st_with_grid, 2);
+  rips_all_pairs.create_complex(st_all_pairs, 2);
+  std::clog << points.size() << " points, threshold " << threshold << ": " << st_all_pairs.num_simplices()
+            << " simplices" << std::endl;
+  BOOST_CHECK(st_with_grid == st_all_pairs);
+}
+
+BOOST_AUTO_TEST_CASE(Rips_complex_from_points_with_grid) {
+  std::clog << "========== Rips_complex_from_points_with_grid ==========" << std::endl;
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  for (int dim = 1; dim <= 4; ++dim) {
+    Vector_of_points points(300, Point(dim));
+    for (auto& p : points)
+      for (auto& x : p) x = unif(gen);
+    for (Filtration_value threshold : {0.01, 0.1, 0.3})
+      test_grid_against_all_pairs(points, threshold);
+    // a single cell
+    points.resize(50);
+    test_grid_against_all_pairs(points, 5.);
+  }
+
+  std::vector<std::array<float, 3>> float_points(300);
+  for (auto& p : float_points)
+    for (auto& x : p) x = unif(gen);
+  test_grid_against_all_pairs(float_points, 0.2);
+
+  // Points on the corners of the cells, at distance exactly threshold, and duplicated points
+  Vector_of_points lattice;
+  for (int i = 0; i < 10; ++i)
+    for (int j = 0; j < 10; ++j) {
+      lattice.push_back({i * 0.1, j * 0.1});
+      lattice.push_back({i * 0.1, j * 0.1});
+    }
+  test_grid_against_all_pairs(lattice, 0.1);
+  test_grid_against_all_pairs(lattice, 0.);
+  lattice.resize(40);
+  test_grid_against_all_pairs(lattice, std::numeric_limits<Filtration_value>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE(Sparse_rips_complex_from_points_with_blocked_distance) {
+  std::clog << "========== Sparse_rips_complex_from_points_with_blocked_distance ==========" << std::endl;
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  Vector_of_points points(60, Point(4));
+  for (auto& p : points)
+    for (auto& x : p) x = unif(gen);
+  // The farthest point order starts at a random point, but for a tiny epsilon, every pair is an edge with its length
+  // as filtration value and nothing is blocked: the result is the full Rips complex.
+  // Sparse_rips_complex uses Gudhi::Blocked_euclidean_distance for Gudhi::Euclidean_distance.
+  Sparse_rips_complex sparse_rips(points, Gudhi::Euclidean_distance(), 1e-9);
+  Rips_complex rips(points, std::numeric_limits<Filtration_value>::infinity(),
+                    [](const Point& p1, const Point& p2) { return Gudhi::Euclidean_distance()(p1, p2); });
+  Simplex_tree st_sparse, st;
+  sparse_rips.create_complex(st_sparse, 2);
+  rips.create_complex(st, 2);
+  std::clog << st.num_simplices() << " simplices" << std::endl;
+  BOOST_CHECK(st_sparse == st);
+}
+
+// Distance that is not declared thread safe: it must only be called from the calling thread.
+struct Thread_checking_distance {
+  std::thread::id thread = std::this_thread::get_id();
+  std::size_t num_calls_from_other_threads = 0;
+  Filtration_value operator()(const Point& p1, const Point& p2) {
+    if (std::this_thread::get_id() != thread) ++num_calls_from_other_threads;
+    return Gudhi::Euclidean_distance()(p1, p2);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(Sparse_rips_complex_sequential_for_user_distance) {
+  std::clog << "========== Sparse_rips_complex_sequential_for_user_distance ==========" << std::endl;
+  static_assert(Gudhi::Is_thread_safe_distance<Gudhi::Euclidean_distance>::value);
+  static_assert(!Gudhi::Is_thread_safe_distance<Thread_checking_distance>::value);
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  Vector_of_points points(2000, Point(3));
+  for (auto& p : points)
+    for (auto& x : p) x = unif(gen);
+  Thread_checking_distance distance;
+  // std::ref so that the calls are counted in distance.
+  Sparse_rips_complex sparse_rips(points, std::ref(distance), 1e-9, 0., .3);
+  BOOST_CHECK(distance.num_calls_from_other_threads == 0);
+  Sparse_rips_complex sparse_rips_euclidean(points, Gudhi::Euclidean_distance(), 1e-9, 0., .3);
+  Simplex_tree st, st_euclidean;
+  sparse_rips.create_complex(st, 2);
+  sparse_rips_euclidean.create_complex(st_euclidean, 2);
+  std::clog << st.num_simplices() << " simplices" << std::endl;
+  BOOST_CHECK(st == st_euclidean);
+}
+
+// Model of SimplicialComplexForRips without the optional batch insertions, so that Rips_complex goes through a graph
+struct Simplex_tree_without_batch_insertion {
+  using Filtration_value = Simplex_tree::Filtration_value;
+  using Simplex_handle = Simplex_tree::Simplex_handle;
+  template <class OneSkeletonGraph>
+  void insert_graph(const OneSkeletonGraph& skel_graph) { st.insert_graph(skel_graph); }
+  void expansion(int max_dim) { st.expansion(max_dim); }
+  std::size_t num_vertices() { return st.num_vertices(); }
+  Simplex_tree st;
+};
+
+BOOST_AUTO_TEST_CASE(Rips_complex_with_and_without_batch_insertion) {
+  std::clog << "========== Rips_complex_with_and_without_batch_insertion ==========" << std::endl;
+  static_assert(Gudhi::rips_complex::Has_batch_insertion<Simplex_tree>::value);
+  static_assert(!Gudhi::rips_complex::Has_batch_insertion<Simplex_tree_without_batch_insertion>::value);
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  Vector_of_points points(200, Point(5));
+  for (auto& p : points)
+    for (auto& x : p) x = unif(gen);
+  Rips_complex rips(points, 1., Gudhi::Euclidean_distance());
+  Simplex_tree st_batch;
+  Simplex_tree_without_batch_insertion st_graph;
+  rips.create_complex(st_batch, 3);
+  rips.create_complex(st_graph, 3);
+  std::clog << st_batch.num_simplices() << " simplices" << std::endl;
+  BOOST_CHECK(st_batch == st_graph.st);
+
+  // Isolated vertices
+  Rips_complex rips_without_edges(points, 0., Gudhi::Euclidean_distance());
+  Simplex_tree st_without_edges;
+  rips_without_edges.create_complex(st_without_edges, 3);
+  BOOST_CHECK(st_without_edges.num_simplices() == points.size());
+  BOOST_CHECK(st_without_edges.dimension() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(Rips_complex_from_mapped_distance_matrix) {
+  std::clog << "========== Rips_complex_from_mapped_distance_matrix ==========" << std::endl;
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> unif(-1., 1.);
+  Vector_of_points points(100, Point(3));
+  for (auto& p : points)
+    for (auto& x : p) x = unif(gen);
+  // Lower triangular matrices, the second one with the precision of the float32 file
+  Distance_matrix distances(points.size()), float_distances(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    for (std::size_t j = 0; j < i; ++j) {
+      distances[i].push_back(Gudhi::Euclidean_distance()(points[i], points[j]));
+      float_distances[i].push_back(static_cast<float>(distances[i][j]));
+    }
+  Gudhi::write_condensed_distance_matrix<double>("rips_distance_matrix_float64.bin", distances);
+  Gudhi::write_condensed_distance_matrix<float>("rips_distance_matrix_float32.bin", distances);
+  Gudhi::Mapped_condensed_distance_matrix<double> mapped_distances("rips_distance_matrix_float64.bin");
+  Gudhi::Mapped_condensed_distance_matrix<float> mapped_float_distances("rips_distance_matrix_float32.bin");
+
+  for (Filtration_value threshold : {0., 0.5, 1.5}) {
+    Simplex_tree st, st_mapped, st_float, st_mapped_float;
+    Rips_complex(distances, threshold).create_complex(st, 2);
+    Rips_complex(mapped_distances, threshold).create_complex(st_mapped, 2);
+    Rips_complex(float_distances, threshold).create_complex(st_float, 2);
+    Rips_complex(mapped_float_distances, threshold).create_complex(st_mapped_float, 2);
+    std::clog << "threshold " << threshold << ": " << st.num_simplices() << " simplices" << std::endl;
+    BOOST_CHECK(st == st_mapped);
+    BOOST_CHECK(st_float == st_mapped_float);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Incremental_rips_complex_checkpoints) {
+  using Simplex_tree_with_links = Gudhi::Simplex_tree<Gudhi::Simplex_tree_options_full_featured>;
+  using Incremental_rips_complex = Gudhi::rips_complex::Incremental_rips_complex<Simplex_tree_with_links>;
+  using Persistent_cohomology =
+      Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree_with_links,
+                                                          Gudhi::persistent_cohomology::Field_Zp>;
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  std::vector<Point> points;
+  for (int i = 0; i < 60; ++i) points.push_back({unif(gen), unif(gen), unif(gen)});
+
+  Incremental_rips_complex incremental_rips(points, Gudhi::Euclidean_distance(), 3);
+  BOOST_CHECK(incremental_rips.complex().num_vertices() == points.size());
+  BOOST_CHECK(incremental_rips.num_edges() == points.size() * (points.size() - 1) / 2);
+  BOOST_CHECK(incremental_rips.num_inserted_edges() == 0);
+
+  std::size_t num_edges = 0;
+  for (double threshold : {0.1, 0.25, 0.4}) {
+    num_edges += incremental_rips.insert_edges_until(threshold);
+    BOOST_CHECK(incremental_rips.num_inserted_edges() == num_edges);
+    BOOST_CHECK(incremental_rips.filtration() <= threshold);
+
+    Simplex_tree_with_links expected;
+    Rips_complex(points, threshold, Gudhi::Euclidean_distance()).create_complex(expected, 3);
+    BOOST_CHECK(incremental_rips.complex() == expected);
+
+    // The persistence can be computed at each checkpoint
+    Persistent_cohomology pcoh(incremental_rips.complex());
+    pcoh.init_coefficients(2);
+    pcoh.compute_persistent_cohomology();
+    Persistent_cohomology expected_pcoh(expected);
+    expected_pcoh.init_coefficients(2);
+    expected_pcoh.compute_persistent_cohomology();
+    auto diagram = pcoh.intervals_in_dimension(1);
+    auto expected_diagram = expected_pcoh.intervals_in_dimension(1);
+    std::sort(diagram.begin(), diagram.end());
+    std::sort(expected_diagram.begin(), expected_diagram.end());
+    std::clog << "Threshold " << threshold << ": " << num_edges << " edges, " << diagram.size() << " H1 intervals"
+              << std::endl;
+    BOOST_CHECK(diagram == expected_diagram);
+  }
+
+  // Edge by edge until the end
+  while (!incremental_rips.is_complete()) BOOST_CHECK(incremental_rips.insert_next_edges(1000) > 0);
+  BOOST_CHECK(incremental_rips.insert_next_edges(1) == 0);
+  Simplex_tree_with_links expected;
+  Rips_complex(points, std::numeric_limits<double>::infinity(), Gudhi::Euclidean_distance())
+      .create_complex(expected, 3);
+  BOOST_CHECK(incremental_rips.complex() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(Weighted_rips_complex_from_points_and_matrix) {
+  using Weighted_rips_complex = Gudhi::rips_complex::Weighted_rips_complex<Filtration_value>;
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  std::vector<Point> points;
+  std::vector<double> weights;
+  for (int i = 0; i < 80; ++i) {
+    points.push_back({unif(gen), unif(gen), unif(gen)});
+    weights.push_back(unif(gen) * 0.2);
+  }
+  Distance_matrix distances(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    for (std::size_t j = 0; j < i; ++j) distances[i].push_back(Gudhi::Euclidean_distance()(points[i], points[j]));
+
+  for (double threshold : {0.2, 0.6, std::numeric_limits<double>::infinity()}) {
+    // Same definition as weighted_rips_complex.py
+    Simplex_tree expected;
+    for (std::size_t i = 0; i < points.size(); ++i)
+      if (2 * weights[i] <= threshold) expected.insert_simplex({static_cast<int>(i)}, 2 * weights[i]);
+    for (std::size_t i = 0; i < points.size(); ++i)
+      for (std::size_t j = 0; j < i; ++j) {
+        double fil = std::max({2 * weights[i], 2 * weights[j], distances[i][j] + weights[i] + weights[j]});
+        if (fil <= threshold) expected.insert_simplex({static_cast<int>(j), static_cast<int>(i)}, fil);
+      }
+    expected.expansion(2);
+
+    Simplex_tree from_points;
+    Weighted_rips_complex(points, weights, threshold, Gudhi::Euclidean_distance()).create_complex(from_points, 2);
+    Simplex_tree from_matrix;
+    Weighted_rips_complex(distances, weights, threshold).create_complex(from_matrix, 2);
+    std::clog << "Weighted Rips of threshold " << threshold << ": " << expected.num_simplices() << " simplices"
+              << std::endl;
+    BOOST_CHECK(from_matrix == expected);
+    BOOST_CHECK(from_points.num_simplices() == expected.num_simplices());
+    for (auto sh : expected.complex_simplex_range()) {
+      std::vector<int> simplex;
+      for (auto v : expected.simplex_vertex_range(sh)) simplex.push_back(v);
+      auto sh2 = from_points.find(simplex);
+      BOOST_REQUIRE(sh2 != from_points.null_simplex());
+      GUDHI_TEST_FLOAT_EQUALITY_CHECK(from_points.filtration(sh2), expected.filtration(sh));
+    }
+  }
+
+  // Zero weights give the Rips complex
+  Simplex_tree weighted;
+  Weighted_rips_complex(points, std::vector<double>(points.size(), 0.), 0.5, Gudhi::Euclidean_distance())
+      .create_complex(weighted, 2);
+  Simplex_tree rips;
+  Rips_complex(points, 0.5, Gudhi::Euclidean_distance()).create_complex(rips, 2);
+  BOOST_CHECK(weighted == rips);
+
+  BOOST_CHECK_THROW(Weighted_rips_complex(distances, std::vector<double>(3, 0.), 1.), std::invalid_argument);
+}
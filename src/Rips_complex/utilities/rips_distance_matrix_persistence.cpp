@@ -12,6 +12,7 @@
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Persistent_cohomology.h>
 #include <gudhi/reader_utils.h>
+#include <gudhi/Mapped_distance_matrix.h>
 
 #include <boost/program_options.hpp>
 
@@ -27,21 +28,37 @@ using Field_Zp = Gudhi::persistent_cohomology::Field_Zp;
 using Persistent_cohomology = Gudhi::persistent_cohomology::Persistent_cohomology<Simplex_tree, Field_Zp>;
 using Distance_matrix = std::vector<std::vector<Filtration_value>>;
 
-void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence);
+void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::string& binary_format,
+                     std::string& filediag, Filtration_value& threshold, int& dim_max, int& p,
+                     Filtration_value& min_persistence);
+
+Rips_complex read_rips_complex(const std::string& matrix_file, const std::string& binary_format,
+                               Filtration_value threshold) {
+  // Binary files are mapped in memory, and only the edges shorter than threshold are loaded
+  if (binary_format == "float32")
+    return Rips_complex(Gudhi::Mapped_condensed_distance_matrix<float>(matrix_file), threshold);
+  if (binary_format == "float64")
+    return Rips_complex(Gudhi::Mapped_condensed_distance_matrix<double>(matrix_file), threshold);
+  if (!binary_format.empty()) {
+    std::cerr << "Unknown binary format " << binary_format << ", expected float32 or float64" << std::endl;
+    exit(-1);
+  }
+  Distance_matrix distances = Gudhi::read_lower_triangular_matrix_from_csv_file<Filtration_value>(matrix_file);
+  return Rips_complex(distances, threshold);
+}
 
 int main(int argc, char* argv[]) {
   std::string csv_matrix_file;
+  std::string binary_format;
   std::string filediag;
   Filtration_value threshold;
   int dim_max;
   int p;
   Filtration_value min_persistence;
 
-  program_options(argc, argv, csv_matrix_file, filediag, threshold, dim_max, p, min_persistence);
+  program_options(argc, argv, csv_matrix_file, binary_format, filediag, threshold, dim_max, p, min_persistence);
 
-  Distance_matrix distances = Gudhi::read_lower_triangular_matrix_from_csv_file<Filtration_value>(csv_matrix_file);
-  Rips_complex rips_complex_from_file(distances, threshold);
+  Rips_complex rips_complex_from_file = read_rips_complex(csv_matrix_file, binary_format, threshold);
 
   // Construct the Rips complex in a Simplex Tree
   Simplex_tree simplex_tree;
@@ -68,8 +85,9 @@ int main(int argc, char* argv[]) {
   return 0;
 }
 
-void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::string& filediag,
-                     Filtration_value& threshold, int& dim_max, int& p, Filtration_value& min_persistence) {
+void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::string& binary_format,
+                     std::string& filediag, Filtration_value& threshold, int& dim_max, int& p,
+                     Filtration_value& min_persistence) {
   namespace po = boost::program_options;
   po::options_description hidden("Hidden options");
   hidden.add_options()(
@@ -80,6 +98,9 @@ void program_options(int argc, char* argv[], std::string& csv_matrix_file, std::
   visible.add_options()("help,h", "produce help message")(
       "output-file,o", po::value<std::string>(&filediag)->default_value(std::string()),
       "Name of file in which the persistence diagram is written. Default print in standard output")(
+      "binary-format,b", po::value<std::string>(&binary_format)->default_value(std::string()),
+      "If set to float32 or float64, the input file is a binary condensed distance matrix (as computed by "
+      "scipy.spatial.distance.pdist) of this type, which is memory mapped instead of being read.")(
       "max-edge-length,r",
       po::value<Filtration_value>(&threshold)->default_value(std::numeric_limits<Filtration_value>::infinity()),
       "Maximal length of an edge for the Rips complex construction.")(
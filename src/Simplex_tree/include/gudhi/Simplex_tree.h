@@ -35,6 +35,7 @@
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/size.hpp>
+#include <boost/range/iterator.hpp>
 #include <boost/container/static_vector.hpp>
 #include <boost/range/adaptors.hpp>
 
@@ -47,6 +48,7 @@
 #endif
 
 #include <utility>  // for std::move
+#include <tuple>
 #include <vector>
 #include <functional>  // for greater<>
 #include <stdexcept>
@@ -1346,6 +1348,113 @@ class Simplex_tree {
     }
   }
 
+  /** \brief Inserts several edges.
+   * @param[in] edges A range of edges, each of them given as a tuple-like `(u, v, filtration)` with `std::get<0>`,
+   * `std::get<1>` and `std::get<2>` returning the two Vertex_handle and the filtration value of the edge, for
+   * instance the output of `Gudhi::collapse::flag_complex_collapse_edges`.
+   *
+   * The vertices of the edges have to be inserted before, for instance with `insert_batch_vertices`. The edges are
+   * grouped by smallest vertex and sorted by largest vertex, then the children of each vertex are filled at once.
+   * Unlike `insert_graph`, no intermediate graph data structure is needed. If @p edges is a forward range already
+   * sorted lexicographically, with `u < v` for each edge `(u, v, filtration)`, it is read directly; otherwise it is
+   * copied into a vector that is sorted.
+   *
+   * The complex does not need to be free of edges before calling this function. However, if an edge is already
+   * present, its filtration value is not modified, unlike with other insertion functions. If an edge appears several
+   * times in @p edges, its smallest filtration value is kept.
+   *
+   * @exception std::invalid_argument If an edge is a self-loop or one of its vertices is not in the complex. All the
+   * edges are checked before the complex is modified, so it is left unchanged in this case. */
+  template <class EdgeRange>
+  void insert_batch_edges(EdgeRange const& edges) {
+    using Edge = std::tuple<Vertex_handle, Vertex_handle, Filtration_value>;
+    using Iterator = typename boost::range_const_iterator<EdgeRange>::type;
+    // Rows sorted by u, columns by v, and smallest filtration value first for duplicates
+    auto edge_less = [](auto const& e1, auto const& e2) {
+      Vertex_handle u1 = std::get<0>(e1), u2 = std::get<0>(e2);
+      if (u1 != u2) return u1 < u2;
+      Vertex_handle v1 = std::get<1>(e1), v2 = std::get<1>(e2);
+      if (v1 != v2) return v1 < v2;
+      return static_cast<Filtration_value>(std::get<2>(e1)) < static_cast<Filtration_value>(std::get<2>(e2));
+    };
+    constexpr bool multipass =
+        std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+    std::vector<Edge> sorted_edges;
+    if constexpr (multipass) {
+      auto ordered = [](auto const& edge) {
+        return static_cast<Vertex_handle>(std::get<0>(edge)) < static_cast<Vertex_handle>(std::get<1>(edge));
+      };
+      if (std::all_of(boost::begin(edges), boost::end(edges), ordered) &&
+          std::is_sorted(boost::begin(edges), boost::end(edges), edge_less)) {
+        insert_sorted_edges(boost::begin(edges), boost::end(edges));
+        return;
+      }
+      sorted_edges.reserve(std::distance(boost::begin(edges), boost::end(edges)));
+    }
+    for (auto const& edge : edges) {
+      Vertex_handle u = std::get<0>(edge);
+      Vertex_handle v = std::get<1>(edge);
+      if (u == v) throw std::invalid_argument("Self-loops are not simplicial");
+      if (v < u) std::swap(u, v);
+      sorted_edges.emplace_back(u, v, std::get<2>(edge));
+    }
+    std::sort(sorted_edges.begin(), sorted_edges.end(), edge_less);
+    insert_sorted_edges(sorted_edges.cbegin(), sorted_edges.cend());
+  }
+
+ private:
+  // Inserts the edges of [first, last), sorted lexicographically with u < v for each edge (u, v, filtration).
+  template <class EdgeIterator>
+  void insert_sorted_edges(EdgeIterator first, EdgeIterator last) {
+    if (first == last) return;
+    auto missing_vertex = [] {
+      return std::invalid_argument(
+          "Simplex_tree::insert_batch_edges - inserts an edge whose vertices are not in the complex");
+    };
+    if (root_.members_.empty()) throw missing_vertex();
+    // When the vertices are contiguous, as in a Rips complex, the search of v is a simple range check
+    const Vertex_handle first_vertex = root_.members_.begin()->first;
+    const Vertex_handle last_vertex = root_.members_.rbegin()->first;
+    const bool contiguous = static_cast<std::size_t>(last_vertex - first_vertex) + 1 == root_.members_.size();
+    auto is_vertex = [&](Vertex_handle v) {
+      if (contiguous) return first_vertex <= v && v <= last_vertex;
+      return root_.members_.find(v) != root_.members_.end();
+    };
+    // All the vertices are checked first, so that nothing is inserted if one is missing
+    for (auto it = first; it != last; ++it)
+      if (!is_vertex(std::get<0>(*it)) || !is_vertex(std::get<1>(*it))) throw missing_vertex();
+
+    Dictionary_it root_it = root_.members_.begin();
+    auto row_begin = first;
+    while (row_begin != last) {
+      const Vertex_handle u = std::get<0>(*row_begin);
+      auto row_end = std::find_if(row_begin, last, [u](auto const& e) { return std::get<0>(e) != u; });
+      // Rows come by increasing u, so do the vertices of the root
+      while (root_it->first < u) ++root_it;
+      if (!has_children(root_it)) {
+        root_it->second.assign_children(new Siblings(&root_, u));
+        if constexpr (!Options::stable_simplex_handles)
+          root_it->second.children()->members().reserve(std::distance(row_begin, row_end));
+      }
+      Siblings* children = root_it->second.children();
+      Dictionary& members = children->members();
+      Vertex_handle previous_v = u;  // no edge (u, u)
+      for (auto it = row_begin; it != row_end; ++it) {
+        const Vertex_handle v = std::get<1>(*it);
+        if (v == previous_v) continue;  // duplicate, the first one has the smallest filtration value
+        previous_v = v;
+        // Appends at the end when the vertex had no children
+        auto size_before = members.size();
+        auto child_it = members.emplace_hint(members.end(), v, Node(children, std::get<2>(*it)));
+        if (members.size() != size_before) update_simplex_tree_after_node_insertion(child_it);
+      }
+      row_begin = row_end;
+    }
+    dimension_ = (std::max)(dimension_, 1);
+  }
+
+ public:
+
   /** \brief Expands the Simplex_tree containing only its one skeleton
    * until dimension max_dim.
    *
@@ -19,6 +19,7 @@
 #include <tuple>  // std::tie
 #include <iterator>  // for std::distance
 #include <cstddef>  // for std::size_t
+#include <list>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "simplex_tree"
@@ -1184,6 +1185,83 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(batch_vertices, typeST, list_of_tested_variants_wo
   }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_edges, typeST, list_of_tested_variants) {
+  std::clog << "********************************************************************" << std::endl;
+  std::clog << "TEST BATCH EDGE INSERTION" << std::endl;
+  using Vertex_handle = typename typeST::Vertex_handle;
+  using Filtration_value = typename typeST::Filtration_value;
+  // Unsorted, with reversed and duplicated edges, as output by the edge collapse for instance
+  std::vector<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>> edges{
+      {3, 1, 2.}, {0, 1, 1.}, {2, 0, 3.}, {1, 2, 4.}, {0, 2, 2.5}, {4, 3, 5.}, {1, 3, 6.}};
+  typeST st;
+  st.insert_batch_vertices(std::vector<Vertex_handle>{0, 1, 2, 3, 4, 5});
+  st.insert_batch_edges(edges);
+  BOOST_CHECK(st.num_vertices() == 6);
+  BOOST_CHECK(st.num_simplices() == 11);
+  BOOST_CHECK(st.dimension() == 1);
+  BOOST_CHECK(st.filtration(st.find({1, 3})) == 2.);
+  BOOST_CHECK(st.filtration(st.find({0, 2})) == 2.5);
+  BOOST_CHECK(st.filtration(st.find({3, 4})) == 5.);
+  BOOST_CHECK(st.find({0, 3}) == st.null_simplex());
+
+  // Same complex as with insert_simplex, also after the expansion
+  typeST st_witness;
+  for (Vertex_handle v = 0; v < 6; ++v) st_witness.insert_simplex({v}, 0.);
+  for (auto& e : edges) {
+    auto sh = st_witness.find({std::get<0>(e), std::get<1>(e)});
+    if (sh == st_witness.null_simplex())
+      st_witness.insert_simplex({std::get<0>(e), std::get<1>(e)}, std::get<2>(e));
+    else if (st_witness.filtration(sh) > std::get<2>(e))
+      st_witness.assign_filtration(sh, std::get<2>(e));
+  }
+  BOOST_CHECK(st == st_witness);
+  st.expansion(3);
+  st_witness.expansion(3);
+  BOOST_CHECK(st == st_witness);
+  BOOST_CHECK(st.filtration(st.find({0, 1, 2})) == 4.);
+
+  // Already present edges are not modified
+  edges = {{2, 5, 1.}, {0, 1, 0.5}};
+  st.insert_batch_edges(edges);
+  BOOST_CHECK(st.num_simplices() == 13);
+  BOOST_CHECK(st.filtration(st.find({0, 1})) == 1.);
+  BOOST_CHECK(st.filtration(st.find({2, 5})) == 1.);
+
+  // Nothing is inserted when an edge is invalid, even after valid edges
+  typeST st_copy(st);
+  edges = {{2, 2, 1.}};
+  BOOST_CHECK_THROW(st.insert_batch_edges(edges), std::invalid_argument);
+  edges = {{2, 7, 1.}};
+  BOOST_CHECK_THROW(st.insert_batch_edges(edges), std::invalid_argument);
+  edges = {{0, 3, 1.}, {2, 4, 1.}, {3, 7, 1.}};
+  BOOST_CHECK_THROW(st.insert_batch_edges(edges), std::invalid_argument);
+  edges = {{4, 0, 1.}, {3, 1, 1.}, {2, 2, 1.}};
+  BOOST_CHECK_THROW(st.insert_batch_edges(edges), std::invalid_argument);
+  BOOST_CHECK(st == st_copy);
+
+  // Already sorted input, read without copy, with duplicates
+  edges = {{0, 3, 2.}, {0, 3, 3.}, {0, 4, 1.}, {3, 5, 0.5}};
+  st.insert_batch_edges(edges);
+  edges = {{0, 3, 2.}, {0, 4, 1.}, {3, 5, 0.5}};
+  st_copy.insert_batch_edges(std::list<std::tuple<Vertex_handle, Vertex_handle, Filtration_value>>(edges.rbegin(),
+                                                                                                     edges.rend()));
+  BOOST_CHECK(st == st_copy);
+  BOOST_CHECK(st.num_simplices() == 16);
+  BOOST_CHECK(st.filtration(st.find({0, 3})) == 2.);
+
+  // Non contiguous vertices
+  if constexpr (!typeST::Options::contiguous_vertices) {
+    typeST st_sparse;
+    st_sparse.insert_batch_vertices(std::vector<Vertex_handle>{10, 20, 30});
+    edges = {{30, 10, 1.}};
+    st_sparse.insert_batch_edges(edges);
+    BOOST_CHECK(st_sparse.num_simplices() == 4);
+    BOOST_CHECK(st_sparse.filtration(st_sparse.find({10, 30})) == 1.);
+    edges = {{10, 25, 1.}};
+    BOOST_CHECK_THROW(st_sparse.insert_batch_edges(edges), std::invalid_argument);
+  }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(simplex_tree_clear, typeST, list_of_tested_variants) {
   std::clog << "********************************************************************" << std::endl;
   std::clog << "TEST SIMPLEX TREE CLEAR" << std::endl;
@@ -21,18 +21,80 @@
  #include <boost/unordered_set.hpp> // preferably with boost 1.79+ for speed
 #endif
 
+#ifdef GUDHI_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
 #include <gudhi/Null_output_iterator.h>
+#include <gudhi/distance_functions.h>
 
+#include <algorithm>  // for std::upper_bound, std::remove_if
 #include <iterator>
 #include <vector>
 #include <utility>
 #include <random>
 #include <limits>
+#include <type_traits>  // for std::is_same, std::decay
 
 namespace Gudhi {
 
 namespace subsampling {
 
+/** \private
+ * Distances from the remaining points of choose_n_farthest_points to a new landmark: calls f(i, d) where d is the
+ * distance from the i-th remaining point to the landmark. The generic version calls dist on each pair.
+ */
+template <class Distance, class Point_range, class = void>
+class Distances_to_landmark {
+ public:
+  Distances_to_landmark(Distance& dist, Point_range const& input_pts) : dist_(dist), input_pts_(input_pts) {}
+  template <class F>
+  void for_each(std::vector<std::size_t> const& points, std::size_t landmark, F&& f) {
+    for (std::size_t i = 0; i < points.size(); ++i) f(i, dist_(input_pts_[points[i]], input_pts_[landmark]));
+  }
+  // The last remaining point replaces the i-th one
+  void move_last_to(std::size_t) {}
+
+ private:
+  Distance& dist_;
+  Point_range const& input_pts_;
+};
+
+/** \private
+ * For Euclidean_distance on float or double coordinates, the remaining points are copied, and updated when one of
+ * them is removed, so that all the distances are computed at once with Blocked_euclidean_distance.
+ */
+template <class Point_range>
+class Distances_to_landmark<
+    Euclidean_distance, Point_range,
+    std::enable_if_t<Has_floating_point_coordinates<typename boost::range_value<Point_range>::type>::value>> {
+  using Coordinate = typename Has_floating_point_coordinates<typename boost::range_value<Point_range>::type>::Coordinate;
+
+ public:
+  Distances_to_landmark(Euclidean_distance&, Point_range const& input_pts)
+      : input_pts_(input_pts), remaining_(input_pts), size_(remaining_.size()) {}
+  template <class F>
+  void for_each(std::vector<std::size_t> const& points, std::size_t landmark, F&& f) {
+    GUDHI_CHECK(points.size() == size_, "inconsistent number of remaining points");
+    query_.assign(std::begin(input_pts_[landmark]), std::end(input_pts_[landmark]));
+    distances_.resize(size_);
+    remaining_.distances(query_.data(), 0, size_, distances_.data());
+    for (std::size_t i = 0; i < size_; ++i) f(i, distances_[i]);
+  }
+  void move_last_to(std::size_t i) {
+    --size_;
+    if (i != size_) remaining_.copy_point(size_, i);
+  }
+
+ private:
+  Point_range const& input_pts_;
+  Blocked_euclidean_distance<Coordinate> remaining_;
+  std::size_t size_;
+  std::vector<Coordinate> query_;
+  std::vector<Coordinate> distances_;
+};
+
 /**
  *  \ingroup subsampling
  */
@@ -104,10 +166,11 @@ void choose_n_farthest_points(Distance dist,
 
   std::vector<std::size_t> points(nb_points);  // map from remaining points to indexes in input_pts
   std::vector< FT > dist_to_L(nb_points);  // vector of current distances to L from points
-  for(std::size_t i = 0; i < nb_points; ++i) {
+  for(std::size_t i = 0; i < nb_points; ++i)
     points[i] = i;
-    dist_to_L[i] = dist(input_pts[i], input_pts[starting_point]);
-  }
+  // Computes the distances to a new landmark, by blocks for Euclidean_distance
+  Distances_to_landmark<Distance, Point_range> distances_to_landmark(dist, input_pts);
+  distances_to_landmark.for_each(points, starting_point, [&](std::size_t i, FT d) { dist_to_L[i] = d; });
   // The indirection through points makes the program a bit slower. Some alternatives:
   // - the original code never removed points and counted on them not
   //   reappearing because of a self-distance of 0. This causes unnecessary
@@ -127,19 +190,17 @@ void choose_n_farthest_points(Distance dist,
       dist_to_L[curr_max_w] = dist_to_L[last];
     }
     points.pop_back();
+    distances_to_landmark.move_last_to(curr_max_w);
 
     // Update distances to L.
-    std::size_t i = 0;
-    for (auto p : points) {
-      FT curr_dist = dist(input_pts[p], input_pts[latest_landmark]);
+    distances_to_landmark.for_each(points, latest_landmark, [&](std::size_t i, FT curr_dist) {
       if (curr_dist < dist_to_L[i])
         dist_to_L[i] = curr_dist;
-      ++i;
-    }
+    });
     // choose the next landmark
     curr_max_w = 0;
     FT curr_max_dist = dist_to_L[curr_max_w];  // used for defining the furthest point from L
-    for (i = 1; i < points.size(); i++)
+    for (std::size_t i = 1; i < points.size(); i++)
       if (dist_to_L[i] > curr_max_dist) {
         curr_max_dist = dist_to_L[i];
         curr_max_w = i;
@@ -187,6 +248,9 @@ bool Compare_landmark_radius<FT>::operator()(std::size_t a, std::size_t b)const{
  *  This computes the same thing as `choose_n_farthest_points()`, but relies on the triangle
  *  inequality to reduce the amount of computation when the doubling dimension and spread are small.
  *  In the worst case, this can be much slower than `choose_n_farthest_points()` though.
+ *  If Intel&reg; oneAPI TBB is available and `Gudhi::Is_thread_safe_distance<Distance>` is true (for instance for
+ *  `Gudhi::Euclidean_distance`), the distances from each new landmark to the points it may take over are computed in
+ *  parallel, so `dist_` is called concurrently from several threads. The result does not change.
  *  See \cite chubet_et_al:LIPIcs.SoCG.2023.64 and its associated video for details about this algorithm.
  *  \tparam Distance must provide an operator() that takes 2 points (value type of the range)
  *  and returns their distance as a `double`. It must be a true metric (\a not squared Euclidean),
@@ -236,6 +300,25 @@ void choose_n_farthest_points_metric(Distance dist_,
   if (final_size == 1) return;
 
   auto dist = [&](std::size_t a, std::size_t b){ return dist_(input_pts[a], input_pts[b]); };
+  // The distances are only computed in parallel if dist_ allows it, most of the time is spent there when the cells
+  // are large.
+#ifdef GUDHI_USE_TBB
+  constexpr bool parallel = Is_thread_safe_distance<Distance>::value;
+#else
+  constexpr bool parallel = false;
+#endif
+  // Sets the second member of each of the `size` pairs at `voronoi` to the distance from its first member to l.
+  auto compute_distances_to = [&](std::size_t l, std::pair<std::size_t, FT>* voronoi, std::size_t size) {
+    if constexpr (parallel) {
+#ifdef GUDHI_USE_TBB
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, size, 1024), [&](const tbb::blocked_range<std::size_t>& r) {
+        for (std::size_t i = r.begin(); i != r.end(); ++i) voronoi[i].second = dist(l, voronoi[i].first);
+      });
+#endif
+    } else {
+      for (std::size_t i = 0; i < size; ++i) voronoi[i].second = dist(l, voronoi[i].first);
+    }
+  };
 
   std::vector<Landmark_info<FT>> landmarks(nb_points);
   radius_priority_ds<FT> radius_priority(&landmarks);
@@ -265,12 +348,18 @@ void choose_n_farthest_points_metric(Distance dist_,
     ini.voronoi.reserve(nb_points - 1);
     for (std::size_t i = 0; i < nb_points; ++i)
       if (i != starting_point)
-        ini.voronoi.emplace_back(i, dist(starting_point, i));
+        ini.voronoi.emplace_back(i, FT());
+    compute_distances_to(starting_point, ini.voronoi.data(), ini.voronoi.size());
     compute_radius(starting_point);
     ini.position_in_queue = radius_priority.push(starting_point);
   }
   // outside the loop to recycle the allocation
   std::vector<std::size_t> modified_neighbors;
+#ifdef GUDHI_USE_TBB
+  std::vector<std::size_t> candidates;
+  std::vector<std::size_t> candidate_offsets;
+  std::vector<FT> candidate_distances;
+#endif
 #if BOOST_VERSION >= 108100
   boost::unordered_flat_set<std::size_t>
 #else
@@ -291,14 +380,17 @@ void choose_n_farthest_points_metric(Distance dist_,
     // BY > XY >= AB - AX - BY, so AB < AX + 2 * BY. Symmetrized.
     auto max_dist = [](FT a, FT b){ return a + b + std::max(a, b); }; // tighter than 3 * radius
     // Check if any Voronoi points from ngb need to move to l
-    auto handle_neighbor_voronoi = [&](std::size_t ngb)
+    // new_distances, if not null, holds the distances from l to the Voronoi points of ngb, already computed.
+    auto handle_neighbor_voronoi = [&](std::size_t ngb, const FT* new_distances = nullptr)
     {
       auto& ngb_info = landmarks[ngb];
-      auto it = std::remove_if(ngb_info.voronoi.begin(), ngb_info.voronoi.end(), [&](auto wd)
+      const auto* first_wd = ngb_info.voronoi.data();
+      // The element tested by remove_if is still at its original position
+      auto it = std::remove_if(ngb_info.voronoi.begin(), ngb_info.voronoi.end(), [&](const auto& wd)
           {
             std::size_t w = wd.first;
             FT d = wd.second;
-            FT newd = dist(l, w);
+            FT newd = new_distances ? new_distances[&wd - first_wd] : dist(l, w);
             if (newd < d) {
               if (w != l) // w==l can only happen for ngb==l_parent
                 info.voronoi.emplace_back(w, newd);
@@ -334,15 +426,42 @@ void choose_n_farthest_points_metric(Distance dist_,
     // radii before pruning neighbor lists. The main drawback is that we have
     // to store modified_neighbors, and we don't have access to the old radii
     // in handle_neighbor_neighbors.
-    handle_neighbor_voronoi(l_parent);
-    // Should we make this loop a remove_if? We already remove in the next loop.
-    for (auto ngb_ : parent_info.neighbors) {
-      std::size_t ngb = ngb_.first;
-      //if(ngb_.second <= max_dist(radius, landmarks[ngb].radius)) // radius from before update_radius(l_parent)
-      //if(ngb_.second <= radius + 2 * landmarks[ngb].radius) // no need to symmetrize
-      // If X can steal a Voronoi point Y from B, then BY > XY >= BX - BY, so BX < 2 * BY.
-      if(dist(l, ngb) < 2 * landmarks[ngb].radius)
-        handle_neighbor_voronoi(ngb);
+    if constexpr (parallel) {
+#ifdef GUDHI_USE_TBB
+      // Same as below, but the distances from l to the Voronoi points of all the candidates are computed first, in
+      // parallel. The radius of a candidate only changes when its own Voronoi cell is handled, so the candidates and
+      // the result are the same.
+      candidates.assign(1, l_parent);
+      for (auto ngb_ : parent_info.neighbors)
+        if(dist(l, ngb_.first) < 2 * landmarks[ngb_.first].radius)
+          candidates.push_back(ngb_.first);
+      candidate_offsets.assign(1, 0);
+      for (std::size_t ngb : candidates)
+        candidate_offsets.push_back(candidate_offsets.back() + landmarks[ngb].voronoi.size());
+      candidate_distances.resize(candidate_offsets.back());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, candidate_distances.size(), 1024),
+                        [&](const tbb::blocked_range<std::size_t>& r) {
+        std::size_t c = std::upper_bound(candidate_offsets.begin(), candidate_offsets.end(), r.begin())
+                        - candidate_offsets.begin() - 1;
+        for (std::size_t k = r.begin(); k != r.end(); ++k) {
+          while (k == candidate_offsets[c + 1]) ++c;
+          candidate_distances[k] = dist(l, landmarks[candidates[c]].voronoi[k - candidate_offsets[c]].first);
+        }
+      });
+      for (std::size_t c = 0; c < candidates.size(); ++c)
+        handle_neighbor_voronoi(candidates[c], candidate_distances.data() + candidate_offsets[c]);
+#endif
+    } else {
+      handle_neighbor_voronoi(l_parent);
+      // Should we make this loop a remove_if? We already remove in the next loop.
+      for (auto ngb_ : parent_info.neighbors) {
+        std::size_t ngb = ngb_.first;
+        //if(ngb_.second <= max_dist(radius, landmarks[ngb].radius)) // radius from before update_radius(l_parent)
+        //if(ngb_.second <= radius + 2 * landmarks[ngb].radius) // no need to symmetrize
+        // If X can steal a Voronoi point Y from B, then BY > XY >= BX - BY, so BX < 2 * BY.
+        if(dist(l, ngb) < 2 * landmarks[ngb].radius)
+          handle_neighbor_voronoi(ngb);
+      }
     }
     // If there are too many neighbors (of neighbors), this could be quadratic (?).
     // Testing every landmark would then be faster, linear.
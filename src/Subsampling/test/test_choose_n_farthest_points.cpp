@@ -133,3 +133,44 @@ BOOST_AUTO_TEST_CASE(test_compare_choose_farthest_point)
   BOOST_CHECK(dist1 == dist2);
   // We may need to replace this last == with an approximate check (or not test dist).
 }
+
+BOOST_AUTO_TEST_CASE(test_choose_farthest_point_with_blocked_distance)
+{
+  std::default_random_engine e;
+  std::uniform_real_distribution<float> r(0,1);
+  typedef std::vector<float> Point;
+  std::vector<Point> points;
+  for(int i=0; i<1000; ++i) {
+    points.push_back({ r(e), r(e), r(e), r(e), r(e) });
+  }
+  std::vector<Point> out1, out2;
+  std::vector<double> dist1, dist2;
+  // Distances computed with Gudhi::Blocked_euclidean_distance for Gudhi::Euclidean_distance, one by one otherwise
+  Gudhi::subsampling::choose_n_farthest_points(Gudhi::Euclidean_distance(), points, 500, 3,
+                                               std::back_inserter(out1), std::back_inserter(dist1));
+  Gudhi::subsampling::choose_n_farthest_points([](const Point& p, const Point& q) { return Gudhi::Euclidean_distance()(p, q); },
+                                               points, 500, 3, std::back_inserter(out2), std::back_inserter(dist2));
+  BOOST_CHECK(out1.size() == 500);
+  BOOST_CHECK(out1 == out2);
+  BOOST_CHECK(dist1 == dist2);
+}
+
+BOOST_AUTO_TEST_CASE(test_compare_choose_farthest_point_with_large_cells)
+{
+  // Enough points for the Voronoi cells of the first landmarks to be processed in parallel with TBB
+  std::default_random_engine e;
+  std::uniform_real_distribution<double> r(0,1);
+  typedef std::array<double, 4> Point;
+  std::vector<Point> orig;
+  for(int i=0; i<5000; ++i) {
+    orig.push_back({ r(e), r(e), r(e), r(e) });
+  }
+  std::vector<Point> out1, out2;
+  std::vector<double> dist1, dist2;
+  Gudhi::Euclidean_distance d;
+  Gudhi::subsampling::choose_n_farthest_points(d, orig, -1, 7, std::back_inserter(out1), std::back_inserter(dist1));
+  Gudhi::subsampling::choose_n_farthest_points_metric(d, orig, -1, 7, std::back_inserter(out2), std::back_inserter(dist2));
+  BOOST_CHECK(out1.size() == 5000);
+  BOOST_CHECK(out1 == out2);
+  BOOST_CHECK(dist1 == dist2);
+}
@@ -0,0 +1,48 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef DOC_ZIGZAG_PERSISTENCE_INTRO_ZIGZAG_PERSISTENCE_H_
+#define DOC_ZIGZAG_PERSISTENCE_INTRO_ZIGZAG_PERSISTENCE_H_
+
+// needs namespace for Doxygen to link on classes
+namespace Gudhi {
+namespace zigzag_persistence {
+
+/** \defgroup zigzag_persistence Zigzag Persistence
+ * @{
+ * \author    agent
+ *
+ * We refer to the introduction page \ref persistent_cohomology for persistent (co)homology for an introduction
+ * to the topic.
+ * Zigzag persistence is a generalization of the latter. While standard persistence only allows to grow the filtered
+ * complex by adding faces, zigzag persistence also allows removals. Hence the name "zigzag", as the module
+ * diagram will have arrows alternating between forward and backward.
+ *
+ * The module consists of the @ref Zigzag_persistence class and implements the algorithm described in
+ * \cite zigzag, on top of a @ref Gudhi::persistence_matrix::Matrix "chain matrix" with vine updates (see
+ * \ref persistence_matrix). The zigzag sequence is processed in a streaming way: faces are inserted with
+ * @ref Zigzag_persistence::insert_face and removed with @ref Zigzag_persistence::remove_face, one arrow at a time,
+ * and each interval is streamed out through a callback as soon as it closes. Only the faces currently in the complex
+ * are stored, so the memory does not grow with the length of the sequence. For example, the sliding windows over a
+ * stream of point clouds can be processed by inserting the faces entering the window and removing the ones
+ * leaving it, without ever recomputing a window from scratch.
+ *
+ * \subsection zigzagexamples Examples
+ *
+ * Here is a list of examples using the module:
+ * \li \gudhi_example_link{Zigzag_persistence,example_zigzag_persistence.cpp} - A simple example showing how to
+ * process a zigzag sequence.
+ *
+ * @}
+ */
+}  // namespace zigzag_persistence
+}  // namespace Gudhi
+
+#endif  // DOC_ZIGZAG_PERSISTENCE_INTRO_ZIGZAG_PERSISTENCE_H_
@@ -0,0 +1,47 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <iostream>
+#include <vector>
+
+#include <gudhi/zigzag_persistence.h>
+
+using Zigzag_persistence = Gudhi::zigzag_persistence::Zigzag_persistence<>;
+using Index = Zigzag_persistence::Index;
+using Dimension = Zigzag_persistence::Dimension;
+
+int main() {
+  // The intervals are streamed out as soon as they close.
+  Zigzag_persistence zp([](Dimension dim, Index birth, Index death) {
+    std::cout << "[" << dim << "] " << birth << " - " << death << std::endl;
+  });
+
+  // A face is identified by the number of the arrow inserting it.
+  Index v0 = zp.insert_face({}, 0);
+  Index v1 = zp.insert_face({}, 0);
+  Index v2 = zp.insert_face({}, 0);
+  Index e01 = zp.insert_face({v0, v1}, 1);
+  Index e02 = zp.insert_face({v0, v2}, 1);
+  Index e12 = zp.insert_face({v1, v2}, 1);
+  Index t012 = zp.insert_face({e01, e02, e12}, 2);
+  zp.remove_face(t012);
+  zp.remove_face(e01);
+  Index v3 = zp.insert_face({}, 0);
+  zp.insert_face({v2, v3}, 1);
+  zp.remove_face(e02);
+  zp.remove_face(v0);
+
+  std::cout << "Intervals still open:" << std::endl;
+  zp.get_current_infinite_intervals([](Dimension dim, Index birth) {
+    std::cout << "[" << dim << "] " << birth << " - inf" << std::endl;
+  });
+
+  return 0;
+}
@@ -0,0 +1,282 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+/**
+ * @file zigzag_persistence.h
+ * @author agent
+ * @brief Contains the implementation of the @ref Gudhi::zigzag_persistence::Zigzag_persistence class.
+ */
+
+#ifndef ZIGZAG_PERSISTENCE_H_
+#define ZIGZAG_PERSISTENCE_H_
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <utility>  //std::move
+#include <algorithm>
+#include <iterator>  //std::back_inserter
+
+#include <gudhi/matrix.h>
+#include <gudhi/persistence_matrix_options.h>
+
+namespace Gudhi {
+namespace zigzag_persistence {
+
+/**
+ * @class Zigzag_persistence zigzag_persistence.h gudhi/zigzag_persistence.h
+ * @brief Class computing the zigzag persistent homology of a zigzag sequence. Algorithm based on \cite zigzag.
+ *
+ * @ingroup zigzag_persistence
+ *
+ * @details The zigzag sequence is given face by face, in a streaming way: each call to @ref insert_face or
+ * @ref remove_face corresponds to the next arrow of the sequence. An interval is streamed out through the
+ * callback given at construction as soon as it closes, so the memory used only depends on the faces currently
+ * in the complex and not on the length of the sequence. The intervals still open at a given moment can be
+ * retrieved with @ref get_current_infinite_intervals.
+ *
+ * Each arrow is identified by its number in the sequence, starting at 0. A face is identified by the number of the
+ * arrow inserting it, which is the value returned by @ref insert_face. This identifier has to be used to refer to
+ * the face in the boundaries of its cofaces and to remove it.
+ *
+ * Only \f$ \mathbb{Z}_2 \f$ coefficients are supported.
+ *
+ * @tparam column_type Column type of the underlying @ref Gudhi::persistence_matrix::Matrix. See
+ * @ref Gudhi::persistence_matrix::Column_types.
+ */
+template <Gudhi::persistence_matrix::Column_types column_type =
+              Gudhi::persistence_matrix::Column_types::INTRUSIVE_LIST>
+class Zigzag_persistence
+{
+ private:
+  using Matrix_type = Gudhi::persistence_matrix::Matrix<Gudhi::persistence_matrix::Zigzag_options<column_type> >;
+  using Matrix_index = typename Matrix_type::index;
+
+ public:
+  using Index = typename Matrix_type::id_index;            /**< Type of arrow numbers and face identifiers. */
+  using Dimension = typename Matrix_type::dimension_type;  /**< Type of dimensions. */
+
+  /**
+   * @brief Constructor.
+   *
+   * @param stream_interval Callback called every time an interval closes. It takes three arguments: the dimension
+   * of the interval, the number of the arrow at which it was born and the number of the arrow at which it died.
+   * @param preallocationSize Reserves space for @p preallocationSize faces in the internal data structure. Optional.
+   * It is better to over-estimate this value than to under-estimate it, but it is not mandatory.
+   */
+  Zigzag_persistence(std::function<void(Dimension, Index, Index)> stream_interval,
+                     unsigned int preallocationSize = 0)
+      : matrix_(
+            preallocationSize,
+            [this](Matrix_index columnIndex1, Matrix_index columnIndex2) -> bool {
+              // H x H case: compares the paired columns in G by their pivots
+              if (matrix_.get_column(columnIndex1).is_paired()) {
+                return matrix_.get_pivot(columnIndex1) < matrix_.get_pivot(columnIndex2);
+              }
+              // F x F case: compares the births of the columns
+              return birthOrdering_.birth_order(births_.at(columnIndex1), births_.at(columnIndex2));
+            },
+            Gudhi::persistence_matrix::_no_G_death_comparator),
+        numArrow_(-1),
+        stream_interval_(std::move(stream_interval)) {}
+
+  // The birth comparator given to the matrix captures `this`, so a copied or moved object would still compare
+  // through the members of the original one.
+  Zigzag_persistence(const Zigzag_persistence&) = delete;
+  Zigzag_persistence(Zigzag_persistence&&) = delete;
+  Zigzag_persistence& operator=(const Zigzag_persistence&) = delete;
+  Zigzag_persistence& operator=(Zigzag_persistence&&) = delete;
+
+  /**
+   * @brief Inserts the given face in the complex. Corresponds to a forward arrow of the zigzag sequence.
+   * The face is assumed to be new in the complex and all its facets are assumed to be present.
+   *
+   * @tparam Boundary_range Range of @ref Index. Assumed to have a begin(), end() and size() method.
+   * @param boundary Identifiers of the facets of the face, that is, the arrow numbers of their insertion.
+   * Has to be sorted by increasing identifiers. Empty for a vertex.
+   * @param dimension Dimension of the face.
+   * @return The arrow number of the insertion, which is also the identifier of the inserted face.
+   */
+  template <class Boundary_range = std::initializer_list<Index> >
+  Index insert_face(const Boundary_range& boundary, Dimension dimension) {
+    ++numArrow_;
+    _process_forward_arrow(boundary, dimension);
+    return numArrow_;
+  }
+
+  /**
+   * @brief Removes the face with the given identifier from the complex. Corresponds to a backward arrow of the
+   * zigzag sequence. The face is assumed to be maximal in the current complex, that is, none of its cofaces is
+   * present.
+   *
+   * @param faceID Identifier of the face to remove, that is, the value returned by @ref insert_face at its insertion.
+   * @return The arrow number of the removal.
+   */
+  Index remove_face(Index faceID) {
+    ++numArrow_;
+    _process_backward_arrow(faceID);
+    return numArrow_;
+  }
+
+  /**
+   * @brief Adds an identity arrow to the zigzag sequence, that is, an arrow which does not modify the complex.
+   * Only useful to keep the arrow numbers aligned with an external indexing of the sequence.
+   *
+   * @return The arrow number of the identity arrow.
+   */
+  Index apply_identity() { return ++numArrow_; }
+
+  /**
+   * @brief Outputs through the given callback all intervals which are still open at the current state of the
+   * zigzag sequence, that is, all intervals which would be infinite if the sequence would stop here.
+   *
+   * @tparam F Type of the callback. Takes a @ref Dimension and an @ref Index as arguments.
+   * @param stream_infinite_interval Method called for each open interval with its dimension and the number of the
+   * arrow at which it was born.
+   */
+  template <typename F>
+  void get_current_infinite_intervals(F&& stream_infinite_interval) {
+    for (const auto& p : births_) {
+      stream_infinite_interval(matrix_.get_column_dimension(p.first), p.second);
+    }
+  }
+
+ private:
+  /**
+   * @brief Maintains the birth ordering \f$ \leq_b \f$ of \cite zigzag. A birth at a forward arrow is the maximal
+   * element of the ordering at the time it is added, a birth at a backward arrow the minimal one.
+   */
+  class Birth_ordering
+  {
+   public:
+    Birth_ordering() : birthToPos_(), maxBirthPos_(0), minBirthPos_(-1) {}
+
+    void add_birth_forward(Index arrowNumber) { birthToPos_.emplace(arrowNumber, maxBirthPos_++); }
+    void add_birth_backward(Index arrowNumber) { birthToPos_.emplace(arrowNumber, minBirthPos_--); }
+    void remove_birth(Index birthKey) { birthToPos_.erase(birthKey); }
+
+    // true iff k1 <b k2
+    bool birth_order(Index k1, Index k2) const { return birthToPos_.at(k1) < birthToPos_.at(k2); }
+    // true iff k1 >b k2
+    bool reverse_birth_order(Index k1, Index k2) const { return birthToPos_.at(k1) > birthToPos_.at(k2); }
+
+   private:
+    std::unordered_map<Index, std::int64_t> birthToPos_;  /**< Birth arrow number to position in the ordering. */
+    std::int64_t maxBirthPos_;                            /**< Next maximal position. */
+    std::int64_t minBirthPos_;                            /**< Next minimal position. */
+  };
+
+  Matrix_type matrix_;                            /**< Compatible bases of the current complex. */
+  std::unordered_map<Matrix_index, Index> births_; /**< Map from the columns in F to the birth of their interval. */
+  Birth_ordering birthOrdering_;                  /**< Birth ordering of the currently open intervals. */
+  Index numArrow_;                                /**< Number of the current arrow. */
+  std::function<void(Dimension, Index, Index)> stream_interval_; /**< Callback for closing intervals. */
+
+  template <class Boundary_range>
+  void _process_forward_arrow(const Boundary_range& boundary, Dimension dim) {
+    std::vector<Matrix_index> chainsInF = matrix_.insert_boundary(numArrow_, boundary, dim);
+
+    if (!chainsInF.empty()) {
+      _apply_surjective_reflection_diamond(dim, chainsInF);
+    } else {
+      birthOrdering_.add_birth_forward(numArrow_);
+      births_.emplace(matrix_.get_column_with_pivot(numArrow_), numArrow_);
+    }
+  }
+
+  /**
+   * @brief The inserted face killed a homology class: the chains in @p chainsInF, sorted by decreasing pivots,
+   * sum up to the boundary of the new face and the matrix already merged them into the first one, now paired.
+   * The interval closing is the one with the maximal birth in \f$ \leq_b \f$ order, so the births of the remaining
+   * chains in F are rearranged accordingly, see \cite zigzag.
+   */
+  void _apply_surjective_reflection_diamond(Dimension dim, const std::vector<Matrix_index>& chainsInF) {
+    // chainFp has the largest death index in <=d order
+    Matrix_index chainFp = chainsInF[0];
+
+    // available births, ordered by decreasing <=b order
+    auto cmp_birth = [this](Index k1, Index k2) -> bool { return birthOrdering_.reverse_birth_order(k1, k2); };
+    std::set<Index, decltype(cmp_birth)> availableBirth(cmp_birth);
+    for (Matrix_index chainF : chainsInF) availableBirth.insert(births_.at(chainF));
+
+    auto maxbIt = availableBirth.begin();
+    Index maxb = *maxbIt;  // birth of the interval to close
+    availableBirth.erase(maxbIt);
+
+    auto lastModifiedChainIt = chainsInF.rbegin();
+
+    // consider all chains by increasing <=d order, that is, by increasing pivots
+    for (auto chainFIt = chainsInF.rbegin(); *chainFIt != chainFp; ++chainFIt) {
+      auto birthIt = availableBirth.find(births_.at(*chainFIt));
+      if (birthIt == availableBirth.end()) {
+        // The birth of the chain is not available anymore: the chain becomes the sum of all chains with smaller
+        // death index, c_i <- c_i + c_{i-1} + ... + c_1, and gets the maximal available birth.
+        for (auto chainPassedIt = lastModifiedChainIt; chainPassedIt != chainFIt; ++chainPassedIt) {
+          matrix_.add_to(*chainPassedIt, *chainFIt);
+        }
+        lastModifiedChainIt = chainFIt;
+
+        auto maxAvailBIt = availableBirth.begin();
+        births_.at(*chainFIt) = *maxAvailBIt;
+        availableBirth.erase(maxAvailBIt);
+      } else {
+        availableBirth.erase(birthIt);
+      }
+    }
+
+    birthOrdering_.remove_birth(maxb);
+    births_.erase(chainFp);
+
+    stream_interval_(dim - 1, maxb, numArrow_);
+  }
+
+  void _process_backward_arrow(Index faceID) {
+    Matrix_index currCol = matrix_.get_column_with_pivot(faceID);
+
+    // columns containing the face, they are the only ones affected by the transpositions moving the face to the end
+    std::vector<Matrix_index> modifiedColumns;
+    const auto& row = matrix_.get_row(faceID);
+    modifiedColumns.reserve(row.size());
+    std::transform(row.begin(), row.end(), std::back_inserter(modifiedColumns),
+                   [](const auto& cell) { return cell.get_column_index(); });
+    // rows are not ordered
+    std::sort(modifiedColumns.begin(), modifiedColumns.end(), [this](Matrix_index i1, Matrix_index i2) {
+      return matrix_.get_pivot(i1) < matrix_.get_pivot(i2);
+    });
+
+    // the first column is the one with pivot faceID
+    for (auto otherColIt = std::next(modifiedColumns.begin()); otherColIt != modifiedColumns.end(); ++otherColIt) {
+      currCol = matrix_.vine_swap(currCol, *otherColIt);
+    }
+
+    // currCol is now the column of the face at the end of the filtration, it cannot be in G as the face is maximal
+    if (!matrix_.get_column(currCol).is_paired()) {
+      // in F: the interval closes
+      auto it = births_.find(currCol);
+      stream_interval_(matrix_.get_column_dimension(currCol), it->second, numArrow_);
+      birthOrdering_.remove_birth(it->second);
+      births_.erase(it);
+    } else {
+      // in H: the paired chain in G becomes a chain in F
+      birthOrdering_.add_birth_backward(numArrow_);
+      births_.emplace(matrix_.get_column(currCol).get_paired_chain_index(), numArrow_);
+    }
+
+    // also un-pairs the column in G if the face was in H
+    matrix_.remove_maximal_face(faceID, {});
+  }
+};
+
+}  // namespace zigzag_persistence
+}  // namespace Gudhi
+
+#endif  // ZIGZAG_PERSISTENCE_H_
@@ -0,0 +1,144 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "zigzag_persistence"
+#include <boost/test/unit_test.hpp>
+#include <boost/mp11.hpp>
+
+#include <gudhi/zigzag_persistence.h>
+#include <gudhi/matrix.h>
+#include <gudhi/persistence_matrix_options.h>
+#include <gudhi/Simplex_tree.h>
+
+using Gudhi::persistence_matrix::Column_types;
+using Gudhi::persistence_matrix::Default_options;
+
+template <Column_types c>
+using Column_type_constant = std::integral_constant<Column_types, c>;
+using list_of_column_types = boost::mp11::mp_list<Column_type_constant<Column_types::INTRUSIVE_LIST>,
+                                                  Column_type_constant<Column_types::INTRUSIVE_SET>,
+                                                  Column_type_constant<Column_types::SET>,
+                                                  Column_type_constant<Column_types::LIST>,
+                                                  Column_type_constant<Column_types::VECTOR>,
+                                                  Column_type_constant<Column_types::NAIVE_VECTOR> >;
+
+using Interval = std::tuple<int, unsigned int, unsigned int>;  // dimension, birth, death
+constexpr unsigned int inf = std::numeric_limits<unsigned int>::max();
+
+template <class ZP>
+std::vector<Interval> get_all_intervals(ZP& zp, std::vector<Interval>& closedIntervals) {
+  std::vector<Interval> res(closedIntervals);
+  zp.get_current_infinite_intervals([&](int dim, unsigned int birth) { res.emplace_back(dim, birth, inf); });
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(zigzag_persistence_single_simplices, Col, list_of_column_types) {
+  using ZP = Gudhi::zigzag_persistence::Zigzag_persistence<Col::value>;
+
+  std::vector<Interval> intervals;
+  ZP zp([&](int dim, unsigned int birth, unsigned int death) { intervals.emplace_back(dim, birth, death); });
+
+  BOOST_CHECK_EQUAL(zp.insert_face({}, 0), 0u);       // 0: v0
+  BOOST_CHECK_EQUAL(zp.insert_face({}, 0), 1u);       // 1: v1
+  BOOST_CHECK_EQUAL(zp.insert_face({0, 1}, 1), 2u);   // 2: e01, kills v1
+  BOOST_CHECK_EQUAL(zp.insert_face({}, 0), 3u);       // 3: v2
+  BOOST_CHECK_EQUAL(zp.insert_face({0, 3}, 1), 4u);   // 4: e02, kills v2
+  BOOST_CHECK_EQUAL(zp.apply_identity(), 5u);         // 5: nothing happens
+  BOOST_CHECK_EQUAL(zp.insert_face({1, 3}, 1), 6u);   // 6: e12, creates a loop
+  BOOST_CHECK_EQUAL(zp.remove_face(2), 7u);           // 7: -e01, kills the loop
+  BOOST_CHECK_EQUAL(zp.remove_face(4), 8u);           // 8: -e02, splits {v0} from {v1,v2}
+  BOOST_CHECK_EQUAL(zp.remove_face(0), 9u);           // 9: -v0, kills the component born at 8
+
+  std::vector<Interval> expected = {{0, 0, inf}, {0, 1, 2}, {0, 3, 4}, {0, 8, 9}, {1, 6, 7}};
+  std::vector<Interval> res = get_all_intervals(zp, intervals);
+  BOOST_CHECK(res == expected);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(zigzag_persistence_filled_triangle, Col, list_of_column_types) {
+  using ZP = Gudhi::zigzag_persistence::Zigzag_persistence<Col::value>;
+
+  std::vector<Interval> intervals;
+  ZP zp([&](int dim, unsigned int birth, unsigned int death) { intervals.emplace_back(dim, birth, death); });
+
+  zp.insert_face({}, 0);          // 0: v0
+  zp.insert_face({}, 0);          // 1: v1
+  zp.insert_face({}, 0);          // 2: v2
+  zp.insert_face({0, 1}, 1);      // 3: e01, kills v1
+  zp.insert_face({0, 2}, 1);      // 4: e02, kills v2
+  zp.insert_face({1, 2}, 1);      // 5: e12, creates a loop
+  zp.insert_face({3, 4, 5}, 2);   // 6: t012, kills the loop
+  zp.remove_face(6);              // 7: -t012, loop born again
+  zp.remove_face(3);              // 8: -e01, kills the loop
+  zp.remove_face(5);              // 9: -e12, v1 alone again
+
+  std::vector<Interval> expected = {{0, 0, inf}, {0, 1, 3}, {0, 2, 4}, {0, 9, inf}, {1, 5, 6}, {1, 7, 8}};
+  std::vector<Interval> res = get_all_intervals(zp, intervals);
+  BOOST_CHECK(res == expected);
+}
+
+struct RU_options : Default_options<Column_types::INTRUSIVE_LIST, true> {
+  static const bool has_column_pairings = true;
+};
+
+// Zigzag sequence K_0 -> ... -> K_n <- ... <- K_0: each finite bar [b,d) of the filtration up to K_n appears twice,
+// once in the ascending part and mirrored in the descending part, and each infinite bar [b,inf) gives [b,2n-1-b).
+BOOST_AUTO_TEST_CASE_TEMPLATE(zigzag_persistence_mirror_of_filtration, Col, list_of_column_types) {
+  using ZP = Gudhi::zigzag_persistence::Zigzag_persistence<Col::value>;
+  using Simplex_tree = Gudhi::Simplex_tree<>;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> unif(0., 1.);
+  const int numberOfVertices = 12;
+  Simplex_tree st;
+  for (int i = 0; i < numberOfVertices; ++i) st.insert_simplex({i}, 0.);
+  for (int i = 0; i < numberOfVertices; ++i)
+    for (int j = i + 1; j < numberOfVertices; ++j) st.insert_simplex({i, j}, unif(gen));
+  st.expansion(3);
+  const unsigned int n = st.num_simplices();
+
+  std::vector<Interval> intervals;
+  ZP zp([&](int dim, unsigned int birth, unsigned int death) { intervals.emplace_back(dim, birth, death); }, n);
+  Gudhi::persistence_matrix::Matrix<RU_options> ru(n);
+
+  std::vector<Simplex_tree::Simplex_handle> order;
+  for (auto sh : st.filtration_simplex_range()) {
+    std::vector<unsigned int> boundary;
+    for (auto b : st.boundary_simplex_range(sh)) boundary.push_back(st.key(b));
+    std::sort(boundary.begin(), boundary.end());
+    int dim = st.dimension(sh);
+    unsigned int id = zp.insert_face(boundary, dim);
+    st.assign_key(sh, id);
+    ru.insert_boundary(boundary, dim);
+    order.push_back(sh);
+  }
+  for (auto it = order.rbegin(); it != order.rend(); ++it) zp.remove_face(st.key(*it));
+
+  std::vector<Interval> expected;
+  for (const auto& bar : ru.get_current_barcode()) {
+    if (bar.death == static_cast<unsigned int>(-1)) {
+      expected.emplace_back(bar.dim, bar.birth, 2 * n - 1 - bar.birth);
+    } else {
+      expected.emplace_back(bar.dim, bar.birth, bar.death);
+      expected.emplace_back(bar.dim, 2 * n - 1 - bar.death, 2 * n - 1 - bar.birth);
+    }
+  }
+  std::sort(expected.begin(), expected.end());
+
+  std::vector<Interval> res = get_all_intervals(zp, intervals);
+  BOOST_CHECK(res == expected);
+}
@@ -0,0 +1,176 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#ifndef MAPPED_DISTANCE_MATRIX_H_
+#define MAPPED_DISTANCE_MATRIX_H_
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cmath>  // for std::sqrt
+#include <cstddef>  // for std::size_t
+#include <cstdint>  // for std::uintmax_t
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>  // for std::swap
+
+namespace Gudhi {
+
+/**
+ * \brief Distance matrix stored in a binary file, in the condensed format, and memory mapped.
+ *
+ * \details
+ * The condensed format of the distance matrix of \f$n\f$ points is the format of `scipy.spatial.distance.pdist`: the
+ * \f$n(n-1)/2\f$ distances \f$d(i,j)\f$ for \f$i<j\f$, ordered by \f$i\f$ then by \f$j\f$, written as raw `float` or
+ * `double` values in the native byte order, without any header. The number of points is deduced from the size of
+ * the file.
+ *
+ * The file is not read in memory, but mapped, and the operating system loads the pages when they are accessed. A
+ * matrix larger than the RAM can then be used as `DistanceMatrix` in `Gudhi::rips_complex::Rips_complex`, which reads
+ * it once with `for_each_row` and only keeps the edges shorter than its threshold.
+ *
+ * `matrix[i][j]` returns \f$d(i,j)\f$ for any \f$i \neq j\f$, and 0 for \f$i = j\f$.
+ *
+ * \tparam T `float` or `double`, type of the values in the file.
+ */
+template <typename T>
+class Mapped_condensed_distance_matrix {
+  static_assert(std::is_floating_point<T>::value, "The values of the file have to be float or double.");
+
+ public:
+  using value_type = T;
+
+  /** \brief Proxy to a row of the matrix. */
+  class Row {
+   public:
+    Row(const Mapped_condensed_distance_matrix& matrix, std::size_t i) : matrix_(matrix), i_(i) {}
+    T operator[](std::size_t j) const { return matrix_(i_, j); }
+
+   private:
+    const Mapped_condensed_distance_matrix& matrix_;
+    std::size_t i_;
+  };
+
+  /** \brief Maps the file `file_name`.
+   *
+   * @exception std::invalid_argument If the file cannot be opened, or if its size is not the size of a condensed
+   * matrix of values of type `T`.
+   */
+  explicit Mapped_condensed_distance_matrix(const std::string& file_name) : size_(0), data_(nullptr) {
+    std::uintmax_t file_size;
+    {
+      std::ifstream in(file_name, std::ios::binary | std::ios::ate);
+      if (!in.is_open()) throw_error("Unable to open file ", file_name);
+      file_size = static_cast<std::uintmax_t>(in.tellg());
+    }
+    if (file_size % sizeof(T) != 0) throw_error("Not a condensed distance matrix: ", file_name);
+    const std::size_t num_distances = file_size / sizeof(T);
+    // n(n-1)/2 = num_distances
+    size_ = static_cast<std::size_t>((1. + std::sqrt(1. + 8. * static_cast<double>(num_distances))) / 2.);
+    while (size_ > 0 && size_ * (size_ - 1) / 2 > num_distances) --size_;
+    while ((size_ + 1) * size_ / 2 <= num_distances) ++size_;
+    if (size_ * (size_ - 1) / 2 != num_distances) throw_error("Not a condensed distance matrix: ", file_name);
+    if (num_distances == 0) return;  // an empty file cannot be mapped
+
+    namespace bip = boost::interprocess;
+    file_ = bip::file_mapping(file_name.c_str(), bip::read_only);
+    // Nothing is loaded before the first access
+    region_ = bip::mapped_region(file_, bip::read_only);
+    data_ = static_cast<const T*>(region_.get_address());
+  }
+
+  /** \brief Returns the number of points. */
+  std::size_t size() const { return size_; }
+
+  /** \brief Returns the distance between points `i` and `j`. */
+  T operator()(std::size_t i, std::size_t j) const {
+    if (i == j) return 0;
+    if (j < i) std::swap(i, j);
+    return row_after_diagonal(i)[j - i - 1];
+  }
+
+  /** \brief Returns a proxy to row `i`, such that `matrix[i][j]` is the distance between points `i` and `j`. */
+  Row operator[](std::size_t i) const { return Row(*this, i); }
+
+  /** \brief Returns a pointer to the contiguous distances \f$d(i,i+1), \dots, d(i,n-1)\f$. */
+  const T* row_after_diagonal(std::size_t i) const { return data_ + offset(i); }
+
+  /** \brief Calls `f(i, row)` for all \f$i\f$ from 0 to \f$n-2\f$, in this order, where `row` points to the
+   * contiguous distances \f$d(i,i+1), \dots, d(i,n-1)\f$.
+   *
+   * The file is mapped again by windows of about `window_size` bytes, each of them unmapped before the next one, so
+   * that at most one window is resident in memory, while the pages accessed through the other methods may stay in
+   * memory as long as the object exists.
+   */
+  template <typename F>
+  void for_each_row(F&& f, std::size_t window_size = std::size_t(1) << 24) const {
+    namespace bip = boost::interprocess;
+    std::size_t i = 0;
+    while (i + 1 < size_) {
+      // Rows [i, last) in the window, at least one
+      const std::size_t first_offset = offset(i);
+      std::size_t last = i + 1;
+      while (last + 1 < size_ && (offset(last + 1) - first_offset) * sizeof(T) <= window_size) ++last;
+      bip::mapped_region window(file_, bip::read_only, first_offset * sizeof(T),
+                                (offset(last) - first_offset) * sizeof(T));
+      window.advise(bip::mapped_region::advice_sequential);
+      const T* window_data = static_cast<const T*>(window.get_address());
+      for (; i < last; ++i) f(i, window_data + offset(i) - first_offset);
+    }
+  }
+
+ private:
+  [[noreturn]] static void throw_error(const std::string& message, const std::string& file_name) {
+    std::string error_str("Mapped_condensed_distance_matrix - " + message + file_name);
+    std::cerr << error_str << std::endl;
+    throw std::invalid_argument(error_str);
+  }
+
+  // Position of d(i,i+1) in the file
+  std::size_t offset(std::size_t i) const { return i * (2 * size_ - i - 1) / 2; }
+
+  boost::interprocess::file_mapping file_;
+  boost::interprocess::mapped_region region_;
+  std::size_t size_;
+  const T* data_;
+};
+
+/**
+ * \brief Writes the distances \f$d(i,j)\f$, \f$i<j\f$, of a distance matrix in a binary file, in the condensed
+ * format read by `Gudhi::Mapped_condensed_distance_matrix<T>`.
+ *
+ * \tparam T `float` or `double`, type of the values written in the file.
+ * \tparam DistanceMatrix must have a `size()` method and `distance_matrix[i][j]` must return the distance between
+ * points \f$i\f$ and \f$j\f$ for \f$0 \leqslant j < i < distance\_matrix.size()\f$, for instance the output of
+ * `Gudhi::read_lower_triangular_matrix_from_csv_file`.
+ */
+template <typename T, typename DistanceMatrix>
+void write_condensed_distance_matrix(const std::string& file_name, const DistanceMatrix& distance_matrix) {
+  std::ofstream out(file_name, std::ios::binary);
+  if (!out.is_open()) {
+    std::string error_str("write_condensed_distance_matrix - Unable to open file " + file_name);
+    std::cerr << error_str << std::endl;
+    throw std::invalid_argument(error_str);
+  }
+  const std::size_t n = distance_matrix.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = i + 1; j < n; ++j) {
+      T d = static_cast<T>(distance_matrix[j][i]);
+      out.write(reinterpret_cast<const char*>(&d), sizeof(T));
+    }
+  }
+}
+
+}  // namespace Gudhi
+
+#endif  // MAPPED_DISTANCE_MATRIX_H_
@@ -20,6 +20,9 @@
 #include <type_traits>  // for std::decay
 #include <iterator>  // for std::begin, std::end
 #include <utility>
+#include <vector>
+#include <algorithm>  // for std::min
+#include <cstddef>  // for std::size_t
 
 namespace Gudhi {
 
@@ -31,6 +34,9 @@ namespace Gudhi {
  * have the same dimension. */
 class Euclidean_distance {
  public:
+  /** @brief `Euclidean_distance` may be called concurrently, see `Gudhi::Is_thread_safe_distance`. */
+  static constexpr bool is_thread_safe = true;
+
   // boost::range_value is not SFINAE-friendly so we cannot use it in the return type
   template< typename Point >
   typename std::iterator_traits<typename boost::range_iterator<Point>::type>::value_type
@@ -57,6 +63,137 @@ class Euclidean_distance {
   }
 };
 
+/** @brief Tells if the distance functor `Distance` may be called concurrently from several threads.
+ *
+ * Algorithms that evaluate many distances with a user given functor, like
+ * `Gudhi::subsampling::choose_n_farthest_points_metric` or `Gudhi::rips_complex::Sparse_rips_complex`, only do it in
+ * parallel (when Intel&reg; oneAPI TBB is available) if this is true. It is false by default, and true when `Distance`
+ * has a static member `is_thread_safe` equal to `true`, as `Gudhi::Euclidean_distance` has. It can also be specialized.
+ */
+template <class Distance, class = void>
+struct Is_thread_safe_distance : std::false_type {};
+
+template <class Distance>
+struct Is_thread_safe_distance<Distance, std::enable_if_t<Distance::is_thread_safe>> : std::true_type {};
+
+/** \private Tells if Point is a range of `float` or `double` coordinates, for which
+ * `Gudhi::Blocked_euclidean_distance` can replace `Gudhi::Euclidean_distance`.
+ */
+template <class Point, class = void>
+struct Has_floating_point_coordinates : std::false_type {};
+
+template <class Point>
+struct Has_floating_point_coordinates<Point, std::void_t<decltype(std::end(std::declval<const Point&>()))>> {
+  using Coordinate = std::decay_t<decltype(*std::begin(std::declval<const Point&>()))>;
+  static constexpr bool value = std::is_same<Coordinate, double>::value || std::is_same<Coordinate, float>::value;
+};
+
+/** @brief Computes many Euclidean distances at once, on a copy of the points where the coordinates are stored
+ * contiguously, coordinate by coordinate.
+ *
+ * The distances from one point to a block of consecutive points are computed together, in a loop over the points of
+ * the block that the compiler vectorizes. The squared differences of coordinates are summed in the same order as in
+ * `Euclidean_distance`, so the distances are the same as the ones of `Euclidean_distance` on the original points.
+ *
+ * \tparam T Type of the coordinates, `float` or `double`.
+ */
+template <class T>
+class Blocked_euclidean_distance {
+ public:
+  /** @brief Copies the coordinates of the points.
+   *
+   * \tparam PointRange Random access range of points, given as ranges of coordinates of the same dimension.
+   */
+  template <class PointRange>
+  explicit Blocked_euclidean_distance(const PointRange& points)
+      : size_(std::distance(std::begin(points), std::end(points))),
+        dimension_(size_ == 0 ? 0 : std::distance(std::begin(*std::begin(points)), std::end(*std::begin(points)))),
+        coordinates_(size_ * dimension_) {
+    std::size_t i = 0;
+    for (auto&& p : points) {
+      GUDHI_CHECK(static_cast<std::size_t>(std::distance(std::begin(p), std::end(p))) == dimension_,
+                  "inconsistent point dimensions");
+      std::size_t k = 0;
+      for (auto x : p) coordinates_[k++ * size_ + i] = x;
+      ++i;
+    }
+  }
+
+  /** @brief Returns the number of points. */
+  std::size_t size() const { return size_; }
+  /** @brief Returns the dimension of the points. */
+  std::size_t dimension() const { return dimension_; }
+
+  /** @brief Writes in `out[0]`, ..., `out[last - first - 1]` the distances from the point `query`, given by its
+   * `dimension()` coordinates, to the points of index `first`, ..., `last - 1`.
+   */
+  void distances(const T* query, std::size_t first, std::size_t last, T* out) const {
+    // Small blocks, so that out stays in the L1 cache during the loop on the coordinates
+    constexpr std::size_t block_size = 256;
+    for (std::size_t begin = first; begin < last; begin += block_size) {
+      const std::size_t end = std::min(begin + block_size, last);
+      T* block_out = out + (begin - first);
+      for (std::size_t j = 0; j < end - begin; ++j) block_out[j] = 0;
+      for (std::size_t k = 0; k < dimension_; ++k) {
+        const T x = query[k];
+        const T* column = coordinates_.data() + k * size_ + begin;
+        for (std::size_t j = 0; j < end - begin; ++j) {
+          T tmp = x - column[j];
+          block_out[j] += tmp * tmp;
+        }
+      }
+      using std::sqrt;
+      for (std::size_t j = 0; j < end - begin; ++j) block_out[j] = sqrt(block_out[j]);
+    }
+  }
+
+  /** @brief Same as above, from the point of index `i`. */
+  void distances(std::size_t i, std::size_t first, std::size_t last, T* out) const {
+    std::vector<T> query = point(i);
+    distances(query.data(), first, last, out);
+  }
+
+  /** @brief Writes in `out[(i - first_query) * (last - first) + j - first]` the distance from the point of index `i`
+   * to the point of index `j`, for `first_query <= i < last_query` and `first <= j < last`.
+   *
+   * Each block of points is used for all the queries while it is in the cache, which matters when the points do not
+   * fit in the cache.
+   */
+  void distances(std::size_t first_query, std::size_t last_query, std::size_t first, std::size_t last,
+                 T* out) const {
+    constexpr std::size_t block_size = 256;
+    const std::size_t row_size = last - first;
+    std::vector<T> queries((last_query - first_query) * dimension_);
+    for (std::size_t i = first_query; i < last_query; ++i)
+      for (std::size_t k = 0; k < dimension_; ++k)
+        queries[(i - first_query) * dimension_ + k] = coordinates_[k * size_ + i];
+    for (std::size_t begin = first; begin < last; begin += block_size) {
+      const std::size_t end = std::min(begin + block_size, last);
+      for (std::size_t i = first_query; i < last_query; ++i)
+        distances(queries.data() + (i - first_query) * dimension_, begin, end,
+                  out + (i - first_query) * row_size + (begin - first));
+    }
+  }
+
+  /** @brief Returns the coordinates of the point of index `i`. */
+  std::vector<T> point(std::size_t i) const {
+    std::vector<T> coordinates(dimension_);
+    for (std::size_t k = 0; k < dimension_; ++k) coordinates[k] = coordinates_[k * size_ + i];
+    return coordinates;
+  }
+
+  /** @brief Replaces the point of index `i` by the point of index `j`. */
+  void copy_point(std::size_t j, std::size_t i) {
+    for (std::size_t k = 0; k < dimension_; ++k) coordinates_[k * size_ + i] = coordinates_[k * size_ + j];
+  }
+
+ private:
+  std::size_t size_;
+  std::size_t dimension_;
+  // coordinates_[k * size_ + i] is the k-th coordinate of the i-th point
+  std::vector<T> coordinates_;
+};
+
 }  // namespace Gudhi
 
 #endif  // DISTANCE_FUNCTIONS_H_
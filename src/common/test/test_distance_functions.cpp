@@ -0,0 +1,66 @@
+/*    This file is part of the Gudhi Library - https://gudhi.inria.fr/ - which is released under MIT.
+ *    See file LICENSE or go to https://gudhi.inria.fr/licensing/ for full license details.
+ *    Author(s):       agent
+ *
+ *    Copyright (C) 2024 Inria
+ *
+ *    Modification(s):
+ *      - YYYY/MM Author: Description of the modification
+ */
+
+#include <gudhi/distance_functions.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE "distance_functions"
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+using list_of_coordinate_types = boost::mpl::list<float, double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(blocked_euclidean_distance, T, list_of_coordinate_types) {
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<T> unif(-10., 10.);
+  // 600 points: several blocks, the last one incomplete
+  for (std::size_t dim : {1, 2, 3, 7, 20}) {
+    std::vector<std::vector<T>> points(600, std::vector<T>(dim));
+    for (auto& p : points)
+      for (auto& x : p) x = unif(gen);
+    Gudhi::Blocked_euclidean_distance<T> blocked_distance(points);
+    BOOST_CHECK(blocked_distance.size() == points.size());
+    BOOST_CHECK(blocked_distance.dimension() == dim);
+    BOOST_CHECK(blocked_distance.point(42) == points[42]);
+
+    std::vector<T> row(points.size());
+    for (std::size_t i : {0, 1, 255, 256, 599}) {
+      blocked_distance.distances(i, 0, points.size(), row.data());
+      for (std::size_t j = 0; j < points.size(); ++j)
+        // Same computation, so exactly the same value
+        BOOST_CHECK_EQUAL(row[j], Gudhi::Euclidean_distance()(points[i], points[j]));
+      blocked_distance.distances(i, i + 1, points.size(), row.data());
+      for (std::size_t j = i + 1; j < points.size(); ++j)
+        BOOST_CHECK_EQUAL(row[j - i - 1], Gudhi::Euclidean_distance()(points[i], points[j]));
+    }
+
+    // Several queries at once
+    std::vector<T> tile(40 * 300);
+    blocked_distance.distances(250, 290, 100, 400, tile.data());
+    for (std::size_t i = 250; i < 290; ++i)
+      for (std::size_t j = 100; j < 400; ++j)
+        BOOST_CHECK_EQUAL(tile[(i - 250) * 300 + j - 100], Gudhi::Euclidean_distance()(points[i], points[j]));
+
+    blocked_distance.copy_point(599, 0);
+    BOOST_CHECK(blocked_distance.point(0) == points[599]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(has_floating_point_coordinates) {
+  BOOST_CHECK(Gudhi::Has_floating_point_coordinates<std::vector<double>>::value);
+  BOOST_CHECK((Gudhi::Has_floating_point_coordinates<std::array<float, 3>>::value));
+  BOOST_CHECK(!Gudhi::Has_floating_point_coordinates<std::vector<int>>::value);
+  BOOST_CHECK(!(Gudhi::Has_floating_point_coordinates<std::pair<double, double>>::value));
+  BOOST_CHECK(!Gudhi::Has_floating_point_coordinates<double>::value);
+}
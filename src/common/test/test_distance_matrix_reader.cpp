@@ -9,14 +9,18 @@
  */
 
 #include <gudhi/reader_utils.h>
+#include <gudhi/Mapped_distance_matrix.h>
 
 #include <iostream>
 #include <string>
 #include <vector>
+#include <fstream>
+#include <stdexcept>
 
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE "distance_matrix_reader"
 #include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
 
 using Distance_matrix = std::vector<std::vector<double>>;
 
@@ -71,3 +75,48 @@ BOOST_AUTO_TEST_CASE( full_square_distance_matrix )
     BOOST_CHECK(from_full_square[i].size() == i);
   }  
 }
+
+using list_of_value_types = boost::mpl::list<float, double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( mapped_condensed_distance_matrix, T, list_of_value_types )
+{
+  Distance_matrix from_full_square =
+      Gudhi::read_lower_triangular_matrix_from_csv_file<double>("full_square_distance_matrix.csv", ';');
+  const std::string file_name = "full_square_distance_matrix_" + std::to_string(sizeof(T)) + ".bin";
+  Gudhi::write_condensed_distance_matrix<T>(file_name, from_full_square);
+
+  Gudhi::Mapped_condensed_distance_matrix<T> mapped(file_name);
+  BOOST_CHECK(mapped.size() == 7);
+  for (std::size_t i = 0; i < mapped.size(); i++) {
+    BOOST_CHECK(mapped[i][i] == 0);
+    for (std::size_t j = 0; j < i; j++) {
+      BOOST_CHECK(mapped[i][j] == static_cast<T>(from_full_square[i][j]));
+      BOOST_CHECK(mapped[j][i] == static_cast<T>(from_full_square[i][j]));
+      BOOST_CHECK(mapped.row_after_diagonal(j)[i - j - 1] == static_cast<T>(from_full_square[i][j]));
+    }
+  }
+
+  // Row by row, with windows of one or several rows
+  for (std::size_t window_size : {std::size_t(1), 4 * sizeof(T), std::size_t(1) << 20}) {
+    std::size_t expected_i = 0;
+    mapped.for_each_row([&](std::size_t i, const T* row) {
+      BOOST_CHECK(i == expected_i++);
+      for (std::size_t j = i + 1; j < mapped.size(); j++)
+        BOOST_CHECK(row[j - i - 1] == static_cast<T>(from_full_square[j][i]));
+    }, window_size);
+    BOOST_CHECK(expected_i == 6);
+  }
+
+  // 4 values is not the size of a condensed matrix
+  {
+    std::ofstream out("wrong_size.bin", std::ios::binary);
+    T values[4] = {1, 2, 3, 4};
+    out.write(reinterpret_cast<const char*>(values), sizeof(values));
+  }
+  BOOST_CHECK_THROW(Gudhi::Mapped_condensed_distance_matrix<T>("wrong_size.bin"), std::invalid_argument);
+  BOOST_CHECK_THROW(Gudhi::Mapped_condensed_distance_matrix<T>("does_not_exist.bin"), std::invalid_argument);
+
+  // A single point
+  { std::ofstream out("single_point.bin", std::ios::binary); }
+  BOOST_CHECK(Gudhi::Mapped_condensed_distance_matrix<T>("single_point.bin").size() == 1);
+}
@@ -23,6 +23,7 @@
 
 #include <gudhi/Persistence_on_a_line.h>
 #include <gudhi/Persistence_on_rectangle.h>
+#include <gudhi/Persistence_on_cube.h>
 #include <gudhi/Debug_utils.h>
 
 namespace py = pybind11;
@@ -73,10 +74,37 @@ py::list wrap_persistence_2d(py::array_t<double, py::array::c_style | py::array:
   return ret;
 }
 
+py::list wrap_persistence_3d(py::array_t<double, py::array::c_style | py::array::forcecast> data, double min_persistence) {
+  py::buffer_info buf = data.request();
+  if(buf.ndim!=3)
+    throw std::runtime_error("Data must be a 3-dimensional array");
+  if(buf.size == 0)
+    throw std::runtime_error("The Python caller is supposed to ensure that the array is not empty");
+  std::vector<std::array<double, 2>> dgm0, dgm1, dgm2;
+  {
+    py::gil_scoped_release release;
+    double mini = Gudhi::cubical_complex::persistence_on_cube_from_top_cells(
+        static_cast<double const*>(buf.ptr),
+        static_cast<std::size_t>(buf.shape[0]),
+        static_cast<std::size_t>(buf.shape[1]),
+        static_cast<std::size_t>(buf.shape[2]),
+        [&](double b, double d){ if (d - b > min_persistence) dgm0.push_back({b, d}); },
+        [&](double b, double d){ if (d - b > min_persistence) dgm1.push_back({b, d}); },
+        [&](double b, double d){ if (d - b > min_persistence) dgm2.push_back({b, d}); });
+    dgm0.push_back({mini, std::numeric_limits<double>::infinity()});
+  }
+  py::list ret;
+  ret.append(py::array(py::cast(std::move(dgm0))));
+  ret.append(py::array(py::cast(std::move(dgm1))));
+  ret.append(py::array(py::cast(std::move(dgm2))));
+  return ret;
+}
+
 PYBIND11_MODULE(_pers_cub_low_dim, m) {
   py::bind_vector<Vf>(m, "VectorPairFloat" , py::buffer_protocol());
   py::bind_vector<Vd>(m, "VectorPairDouble", py::buffer_protocol());
   m.def("_persistence_on_a_line", wrap_persistence_1d<float>, py::arg().noconvert());
   m.def("_persistence_on_a_line", wrap_persistence_1d<double>);
   m.def("_persistence_on_rectangle_from_top_cells", wrap_persistence_2d);
+  m.def("_persistence_on_cube_from_top_cells", wrap_persistence_3d);
 }
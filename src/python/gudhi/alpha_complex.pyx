@@ -16,7 +16,9 @@ from libcpp.utility cimport pair
 from libcpp.string cimport string
 from libcpp cimport bool
 from libc.stdint cimport intptr_t
+from libc.string cimport memcpy
 import warnings
+import numpy as np
 
 from gudhi.simplex_tree cimport *
 from gudhi.simplex_tree import SimplexTree
@@ -35,6 +37,9 @@ cdef extern from "Alpha_complex_interface.h" namespace "Gudhi":
         void set_float_relative_precision(double precision) nogil
         @staticmethod
         double get_float_relative_precision() nogil
+    void alpha_persistence_batch "Gudhi::alpha_complex::alpha_persistence_batch"(vector[vector[vector[double]]] point_clouds,
+            double max_alpha_square, double min_persistence, bool fast_version, bool exact_version,
+            vector[int]& dimensions, vector[double]& intervals, vector[size_t]& offsets) nogil except +
 
 # AlphaComplex python interface
 cdef class AlphaComplex:
@@ -121,7 +126,8 @@ cdef class AlphaComplex:
     def create_simplex_tree(self, max_alpha_square = float('inf'), default_filtration_value = False):
         """
         :param max_alpha_square: The maximum alpha square threshold the simplices shall not exceed. Default is set to
-            infinity, and there is very little point using anything else since it does not save time.
+            infinity. The simplices above this value are not inserted at all, which saves time and memory when it is
+            small compared to the filtration values of the Delaunay cells.
         :type max_alpha_square: float
         :param default_filtration_value: Set this value to `True` if filtration values are not needed to be computed
             (will be set to `NaN`). Default value is `False` (which means compute the filtration values).
@@ -162,3 +168,51 @@ cdef class AlphaComplex:
         :rtype: float
         """
         return Alpha_complex_interface.get_float_relative_precision()
+
+
+def compute_alpha_persistence_batch(point_clouds, precision = 'fast', max_alpha_square = float('inf'),
+                                    min_persistence = 0.):
+    """Computes the persistence diagrams of the alpha complexes of many point clouds, without building any
+    :class:`~gudhi.SimplexTree`. The clouds are processed in parallel when `precision` is 'fast', and the buffers
+    of the computation are reused from one cloud to the next. The persistence is computed with coefficients in
+    :math:`\\mathbb{Z}/2\\mathbb{Z}`.
+
+    :param point_clouds: A list of point clouds, each of them a list of points in d-Dimension.
+    :type point_clouds: Iterable[Iterable[Iterable[float]]]
+    :param precision: Alpha complex precision can be 'fast', 'safe' or 'exact', as for :class:`~gudhi.AlphaComplex`.
+        Default is 'fast'.
+    :type precision: string
+    :param max_alpha_square: The maximum alpha square threshold of the filtrations. The intervals that are not dead at
+        this value have an infinite death. Default is infinity.
+    :type max_alpha_square: float
+    :param min_persistence: Only the intervals of length strictly greater than `min_persistence` are returned.
+        Default is 0.
+    :type min_persistence: float
+    :returns: The dimensions of the intervals, of shape (n,), their births and deaths, of shape (n, 2), and the
+        offsets, of shape (number of point clouds + 1,), such that the intervals of the i-th point cloud are the ones
+        from offsets[i] to offsets[i+1] (excluded), sorted by dimension then by decreasing lifetime.
+    :rtype: tuple(numpy.ndarray of int, numpy.ndarray of float, numpy.ndarray of int)
+    """
+    assert precision in ['fast', 'safe', 'exact'], "Alpha complex precision can only be 'fast', 'safe' or 'exact'"
+    cdef bool fast = precision == 'fast'
+    cdef bool exact = precision == 'exact'
+    cdef double mas = max_alpha_square
+    cdef double min_pers = min_persistence
+    # need to copy the points to use them without the gil
+    cdef vector[vector[vector[double]]] clouds = point_clouds
+    cdef vector[int] dimensions
+    cdef vector[double] intervals
+    cdef vector[size_t] offsets
+    with nogil:
+        alpha_persistence_batch(clouds, mas, min_pers, fast, exact, dimensions, intervals, offsets)
+    np_dimensions = np.empty(dimensions.size(), dtype=np.intc)
+    np_intervals = np.empty((dimensions.size(), 2), dtype=np.float64)
+    np_offsets = np.empty(offsets.size(), dtype=np.uintp)
+    cdef int[::1] dimensions_view = np_dimensions
+    cdef double[:, ::1] intervals_view = np_intervals
+    cdef size_t[::1] offsets_view = np_offsets
+    if dimensions.size() > 0:
+        memcpy(&dimensions_view[0], dimensions.data(), dimensions.size() * sizeof(int))
+        memcpy(&intervals_view[0, 0], intervals.data(), intervals.size() * sizeof(double))
+    memcpy(&offsets_view[0], offsets.data(), offsets.size() * sizeof(size_t))
+    return np_dimensions, np_intervals, np_offsets
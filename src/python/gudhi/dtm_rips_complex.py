@@ -9,8 +9,8 @@
 
 
 from gudhi.weighted_rips_complex import WeightedRipsComplex
+from gudhi.rips_complex import _WeightedRipsComplex
 from gudhi.point_cloud.dtm import DistanceToMeasure
-from scipy.spatial.distance import cdist
 import numpy as np
 
 
@@ -34,9 +34,12 @@ class DTMRipsComplex(WeightedRipsComplex):
             q (float): order used to compute the distance to measure. Defaults to 2.
             max_filtration (float): specifies the maximal filtration value to be considered.
         """
+        # With points, the DTM comes from the k nearest neighbors, and the distances are only computed in C++ for the
+        # pairs that may be under max_filtration, without a full distance matrix.
+        self.points = None
         if distance_matrix is None:
             if points is not None:
-                distance_matrix = cdist(points, points)
+                self.points = points
             else:
                 # Empty Rips construction
                 distance_matrix = np.ndarray((0,0))
@@ -44,8 +47,21 @@ class DTMRipsComplex(WeightedRipsComplex):
 
         # TODO: address the error when k is too large
         if k <= 1:
-            self.weights = [0] * len(distance_matrix)
+            self.weights = [0] * len(points if self.points is not None else distance_matrix)
+        elif self.points is not None:
+            self.weights = DistanceToMeasure(k, q=q).fit_transform(self.points)
         else:
             dtm = DistanceToMeasure(k, q=q, metric="precomputed")
             self.weights = dtm.fit_transform(distance_matrix)
         self.max_filtration = max_filtration
+
+    def create_simplex_tree(self, max_dimension):
+        """
+        Args:
+            max_dimension (int): graph expansion until this given dimension.
+        """
+        if self.points is None:
+            return super().create_simplex_tree(max_dimension)
+        return _WeightedRipsComplex(
+            points=self.points, weights=self.weights, max_filtration=self.max_filtration
+        ).create_simplex_tree(max_dimension)
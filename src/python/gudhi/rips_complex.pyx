@@ -28,6 +28,8 @@ cdef extern from "Rips_complex_interface.h" namespace "Gudhi":
         void init_matrix(vector[vector[double]] values, double threshold) nogil
         void init_points_sparse(vector[vector[double]] values, double threshold, double sparse) nogil
         void init_matrix_sparse(vector[vector[double]] values, double threshold, double sparse) nogil
+        void init_points_weighted(vector[vector[double]] values, vector[double] weights, double threshold) nogil except +
+        void init_matrix_weighted(vector[vector[double]] values, vector[double] weights, double threshold) nogil except +
         void create_simplex_tree(Simplex_tree_python_interface* simplex_tree, int dim_max) nogil except +
 
 # RipsComplex python interface
@@ -94,3 +96,23 @@ cdef class RipsComplex:
         with nogil:
             self.thisref.create_simplex_tree(<Simplex_tree_python_interface*>stree_int_ptr, maxdim)
         return stree
+
+
+# Used by gudhi.weighted_rips_complex.WeightedRipsComplex and gudhi.dtm_rips_complex.DTMRipsComplex, which document it.
+# With points, the distances are Euclidean, and only the pairs that may be under max_filtration are computed.
+cdef class _WeightedRipsComplex:
+    cdef Rips_complex_interface thisref
+
+    def __cinit__(self, *, points=None, distance_matrix=None, weights, max_filtration):
+        if distance_matrix is not None:
+            self.thisref.init_matrix_weighted(distance_matrix, weights, max_filtration)
+        else:
+            self.thisref.init_points_weighted(points, weights, max_filtration)
+
+    def create_simplex_tree(self, max_dimension):
+        stree = SimplexTree()
+        cdef intptr_t stree_int_ptr=stree.thisptr
+        cdef int maxdim = max_dimension
+        with nogil:
+            self.thisref.create_simplex_tree(<Simplex_tree_python_interface*>stree_int_ptr, maxdim)
+        return stree
@@ -8,7 +8,11 @@
 #   - YYYY/MM Author: Description of the modification
 
 from .. import CubicalComplex
-from .._pers_cub_low_dim import _persistence_on_a_line, _persistence_on_rectangle_from_top_cells
+from .._pers_cub_low_dim import (
+    _persistence_on_a_line,
+    _persistence_on_rectangle_from_top_cells,
+    _persistence_on_cube_from_top_cells,
+)
 from sklearn.base import BaseEstimator, TransformerMixin
 
 import numpy as np
@@ -91,6 +95,13 @@ class CubicalPersistence(BaseEstimator, TransformerMixin):
                 diags = _persistence_on_rectangle_from_top_cells(cells, self.min_persistence)
             return [diags[i] if i in (0, 1) else np.empty((0,2)) for i in self.dim_list_]
 
+        if len(cells.shape) == 3 and self.input_type == 'top_dimensional_cells' and self.min_persistence >= 0:
+            if cells.size == 0:
+                diags = [np.empty((0,2)), np.empty((0,2)), np.empty((0,2))]
+            else:
+                diags = _persistence_on_cube_from_top_cells(cells, self.min_persistence)
+            return [diags[i] if i in (0, 1, 2) else np.empty((0,2)) for i in self.dim_list_]
+
         if self.input_type == 'top_dimensional_cells':
             cubical_complex = CubicalComplex(top_dimensional_cells=cells)
         elif self.input_type == 'vertices':
@@ -7,7 +7,7 @@
 # Modification(s):
 #   - YYYY/MM Author: Description of the modification
 
-from gudhi import SimplexTree
+from gudhi.rips_complex import _WeightedRipsComplex
 
 class WeightedRipsComplex:
     """
@@ -40,22 +40,7 @@ class WeightedRipsComplex:
         Args:
             max_dimension (int): graph expansion until this given dimension.
         """
-        dist = self.distance_matrix
-        F = self.weights
-        num_pts = len(dist)
-        
-        st = SimplexTree()
-        
-        for i in range(num_pts):
-            if 2*F[i] <= self.max_filtration:
-                st.insert([i], 2*F[i])
-        for i in range(num_pts):
-            for j in range(i):
-                value = max(2*F[i], 2*F[j], dist[i][j] + F[i] + F[j])
-                # max is needed when F is not 1-Lipschitz
-                if value <= self.max_filtration:
-                    st.insert([i,j], filtration=value)
-                    
-        st.expansion(max_dimension) 
-        return st
-        
+        # The pairs are enumerated, pruned and inserted in C++
+        return _WeightedRipsComplex(
+            distance_matrix=self.distance_matrix, weights=self.weights, max_filtration=self.max_filtration
+        ).create_simplex_tree(max_dimension)
@@ -13,6 +13,7 @@
 
 #include "Alpha_complex_factory.h"
 #include <gudhi/Alpha_complex_options.h>
+#include <gudhi/Alpha_persistence_batch.h>
 
 #include "Simplex_tree_interface.h"
 
@@ -20,6 +21,7 @@
 #include <vector>
 #include <string>
 #include <memory>  // for std::unique_ptr
+#include <cstddef>  // for std::size_t
 
 namespace Gudhi {
 
@@ -71,6 +73,38 @@ class Alpha_complex_interface {
   std::unique_ptr<Abstract_alpha_complex> alpha_ptr_;
 };
 
+template <typename Kernel>
+void compute_alpha_persistence_batch(const std::vector<std::vector<std::vector<double>>>& point_clouds,
+                                     double max_alpha_square, double min_persistence, bool exact_version,
+                                     std::vector<int>& dimensions, std::vector<double>& intervals,
+                                     std::vector<std::size_t>& offsets) {
+  using Point = typename Kernel::Point_d;
+  // Only views on the points, they are converted by the Alpha_complex constructor
+  std::vector<decltype(boost::adaptors::transform(point_clouds[0], pt_cython_to_cgal<Point>))> clouds;
+  clouds.reserve(point_clouds.size());
+  for (auto const& points : point_clouds)
+    clouds.push_back(boost::adaptors::transform(points, pt_cython_to_cgal<Point>));
+  Alpha_persistence_batch<Kernel> batch(max_alpha_square, min_persistence, exact_version);
+  batch.compute(clouds);
+  dimensions = batch.dimensions();
+  intervals = batch.intervals();
+  offsets = batch.offsets();
+}
+
+// Persistence diagrams of the alpha complexes of several point clouds, as contiguous arrays
+inline void alpha_persistence_batch(const std::vector<std::vector<std::vector<double>>>& point_clouds,
+                                    double max_alpha_square, double min_persistence, bool fast_version,
+                                    bool exact_version, std::vector<int>& dimensions, std::vector<double>& intervals,
+                                    std::vector<std::size_t>& offsets) {
+  // cf. Inexact_alpha_complex_dD and Exact_alpha_complex_dD kernel types in Alpha_complex_factory.h
+  if (fast_version)
+    compute_alpha_persistence_batch<CGAL::Epick_d<CGAL::Dynamic_dimension_tag>>(
+        point_clouds, max_alpha_square, min_persistence, false, dimensions, intervals, offsets);
+  else
+    compute_alpha_persistence_batch<CGAL::Epeck_d<CGAL::Dynamic_dimension_tag>>(
+        point_clouds, max_alpha_square, min_persistence, exact_version, dimensions, intervals, offsets);
+}
+
 }  // namespace alpha_complex
 
 }  // namespace Gudhi
@@ -14,6 +14,7 @@
 #include <gudhi/Simplex_tree.h>
 #include <gudhi/Rips_complex.h>
 #include <gudhi/Sparse_rips_complex.h>
+#include <gudhi/Weighted_rips_complex.h>
 #include <gudhi/distance_functions.h>
 
 #include <boost/optional.hpp>
@@ -48,9 +49,20 @@ class Rips_complex_interface {
     sparse_rips_complex_.emplace(matrix, epsilon, -std::numeric_limits<double>::infinity(), threshold);
   }
 
+  void init_points_weighted(const std::vector<std::vector<double>>& points, const std::vector<double>& weights,
+                            double threshold) {
+    weighted_rips_complex_.emplace(points, weights, threshold, Gudhi::Euclidean_distance());
+  }
+  void init_matrix_weighted(const std::vector<std::vector<double>>& matrix, const std::vector<double>& weights,
+                            double threshold) {
+    weighted_rips_complex_.emplace(matrix, weights, threshold);
+  }
+
   void create_simplex_tree(Simplex_tree_interface* simplex_tree, int dim_max) {
     if (rips_complex_)
       rips_complex_->create_complex(*simplex_tree, dim_max);
+    else if (weighted_rips_complex_)
+      weighted_rips_complex_->create_complex(*simplex_tree, dim_max);
     else
       sparse_rips_complex_->create_complex(*simplex_tree, dim_max);
   }
@@ -60,6 +72,7 @@ class Rips_complex_interface {
   // Anyway, storing a graph would make more sense. Or changing the interface completely so there is no such storage.
   boost::optional<Rips_complex<Simplex_tree_interface::Filtration_value>> rips_complex_;
   boost::optional<Sparse_rips_complex<Simplex_tree_interface::Filtration_value>> sparse_rips_complex_;
+  boost::optional<Weighted_rips_complex<Simplex_tree_interface::Filtration_value>> weighted_rips_complex_;
 };
 
 }  // namespace rips_complex
@@ -8,7 +8,7 @@
       - YYYY/MM Author: Description of the modification
 """
 
-from gudhi import AlphaComplex
+from gudhi import AlphaComplex, compute_alpha_persistence_batch
 import math
 import numpy as np
 import pytest
@@ -322,3 +322,18 @@ def test_numpy_arrays():
                     [ 2.,  2.,  2.]])
     weights=np.array([4., 4., 4., 4., 1.])
     alpha = AlphaComplex(points=points, weights=weights)
+
+def _alpha_persistence_batch(precision):
+    rng = np.random.default_rng(42)
+    point_clouds = [rng.random((30, 3)) for _ in range(10)] + [[]]
+    dimensions, intervals, offsets = compute_alpha_persistence_batch(point_clouds, precision=precision)
+    assert len(offsets) == len(point_clouds) + 1
+    assert offsets[-1] == len(dimensions) == len(intervals)
+    for idx, points in enumerate(point_clouds):
+        diagram = sorted((int(dimensions[j]), tuple(intervals[j])) for j in range(offsets[idx], offsets[idx + 1]))
+        stree = AlphaComplex(points=points, precision=precision).create_simplex_tree()
+        assert diagram == sorted(stree.persistence(homology_coeff_field=2))
+
+def test_alpha_persistence_batch():
+    for precision in ['fast', 'safe', 'exact']:
+        _alpha_persistence_batch(precision)
@@ -10,6 +10,7 @@
 
 from gudhi.dtm_rips_complex import DTMRipsComplex
 from gudhi import RipsComplex
+from scipy.spatial.distance import cdist
 import numpy as np
 from math import sqrt
 import pytest
@@ -40,3 +41,18 @@ def test_empty_dtm_rips_complex():
     st = dtm_rips.create_simplex_tree(max_dimension=1)
     assert st.num_simplices() == 0
     assert st.dimension() == -1
+
+
+def test_dtm_rips_complex_from_points_and_distance_matrix():
+    # From points, the DTM uses the k nearest neighbors and the distances are computed in C++
+    pts = np.random.default_rng(42).random((50, 3))
+    for k, max_filtration in [(1, float("inf")), (3, float("inf")), (5, 0.8)]:
+        st_points = DTMRipsComplex(points=pts, k=k, max_filtration=max_filtration).create_simplex_tree(max_dimension=2)
+        st_matrix = DTMRipsComplex(distance_matrix=cdist(pts, pts), k=k, max_filtration=max_filtration).create_simplex_tree(
+            max_dimension=2
+        )
+        filtration_points = {tuple(s): f for s, f in st_points.get_filtration()}
+        filtration_matrix = {tuple(s): f for s, f in st_matrix.get_filtration()}
+        assert filtration_points.keys() == filtration_matrix.keys()
+        for simplex, f in filtration_matrix.items():
+            assert filtration_points[simplex] == pytest.approx(f)
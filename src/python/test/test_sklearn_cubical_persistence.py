@@ -66,6 +66,10 @@ def cmp(a):
 
 def test_compare_top_cells():
     cmp(np.random.rand(20,15,10))
+    cmp(np.random.randint(5, size=(12,10,8)).astype(float))
+    cmp(np.random.rand(1,15,10))
+    cmp(np.random.rand(20,2,1))
+    cmp(np.random.rand(20,15,10)[::2,::-1])
     cmp(np.random.rand(20,10))
     cmp(np.random.rand(20,2))
     cmp(np.random.rand(2,20))
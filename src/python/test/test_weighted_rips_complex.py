@@ -61,3 +61,8 @@ def test_dtm_rips_complex():
     persistence_intervals0 = st.persistence_intervals_in_dimension(0)
     assert persistence_intervals0 == pytest.approx(np.array([[3.16227766, 5.39834564],[3.16227766, 5.39834564], [3.16227766, float("inf")]]))
     
+
+def test_one_weight_per_point():
+    w_rips = WeightedRipsComplex(distance_matrix=[[], [1]], weights=[1])
+    with pytest.raises(ValueError):
+        w_rips.create_simplex_tree(max_dimension=1)